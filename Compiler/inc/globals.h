@@ -81,6 +81,23 @@ typedef char* string;
 extern FILE *log_file;
 extern bool graph_copying;
 extern bool program_tracing;
+extern bool incremental_matching;
+extern bool locality_matching;
+extern bool join_matching;
+extern bool batch_matching;
+extern bool shared_rule_sets;
+extern int bitmap_budget;
+extern int match_threads;
+extern int component_workers;
+extern bool speculative_branches;
+
+/* The order in which the rules of a rule set call are tried at runtime.
+ * SOURCE_ORDER - The order of the rules in the program text.
+ * MOVE_TO_FRONT - The last rule of the set to match is tried first.
+ * MATCH_COUNT - The rules are tried in decreasing order of the number of
+ *               times they have matched. */
+typedef enum {SOURCE_ORDER = 0, MOVE_TO_FRONT, MATCH_COUNT} RuleSetPolicy;
+extern RuleSetPolicy rule_set_policy;
 
 /* Bison uses a global variable yylloc of type YYLTYPE to keep track of the 
  * locations of tokens and nonterminals. The scanner will set these values upon
@@ -100,6 +117,17 @@ typedef enum {INTEGER_VAR = 0, CHARACTER_VAR, STRING_VAR, ATOM_VAR, LIST_VAR} GP
 
 typedef enum {NONE = 0, RED, GREEN, BLUE, GREY, DASHED, ANY} MarkType; 
 
+/* The number of marks a host item can have (ANY is not one of them), and the
+ * number of label lengths distinguished by the element counts of a host graph.
+ * Shared by the compiler and the runtime (see lib/graph.h). */
+#define HOST_MARKS 6
+#define COUNTED_LENGTHS 4
+
+/* Host nodes are divided into classes by mark and counted label length for
+ * change tracking (see classesChangedSince in lib/graph.h). */
+#define NODE_CLASSES (HOST_MARKS * COUNTED_LENGTHS)
+#define NODE_CLASS(mark, length) ((mark) * COUNTED_LENGTHS + (length))
+
 typedef enum {INT_CHECK = 0, CHAR_CHECK, STRING_CHECK, ATOM_CHECK, EDGE_PRED,
               EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL, 
 	      BOOL_NOT, BOOL_OR, BOOL_AND } ConditionType;
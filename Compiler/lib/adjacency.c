@@ -0,0 +1,272 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "adjacency.h"
+
+static int compareNeighbours(const void *left, const void *right)
+{
+   const Neighbour *left_item = left, *right_item = right;
+   if(left_item->node != right_item->node)
+      return left_item->node < right_item->node ? -1 : 1;
+   if(left_item->edge != right_item->edge)
+      return left_item->edge < right_item->edge ? -1 : 1;
+   return 0;
+}
+
+/* Rebuilds one list of the node's view. The previous items array is reused. */
+static void buildNeighbourList(Graph *graph, Node *node, NeighbourList *list,
+                               bool outgoing)
+{
+   int degree = outgoing ? node->outdegree : node->indegree;
+   list->items = realloc(list->items, (degree > 0 ? degree : 1) * sizeof(Neighbour));
+   if(list->items == NULL)
+   {
+      print_to_log("Error (buildNeighbourList): malloc failure.\n");
+      exit(1);
+   }
+   list->size = 0;
+   int counter, extra = outgoing ? node->out_edges.size : node->in_edges.size;
+   for(counter = 0; counter < extra + 2; counter++)
+   {
+      Edge *edge = outgoing ? getNthOutEdge(graph, node, counter) :
+                              getNthInEdge(graph, node, counter);
+      if(edge == NULL) continue;
+      list->items[list->size].node = outgoing ? edge->target : edge->source;
+      list->items[list->size].edge = edge->index;
+      list->size++;
+   }
+   qsort(list->items, list->size, sizeof(Neighbour), compareNeighbours);
+}
+
+static NodeAdjacency *getNodeAdjacency(Graph *graph, int index)
+{
+   SortedAdjacency *view = graph->sorted_adjacency;
+   if(view == NULL)
+   {
+      view = malloc(sizeof(SortedAdjacency));
+      if(view == NULL)
+      {
+         print_to_log("Error (getNodeAdjacency): malloc failure.\n");
+         exit(1);
+      }
+      view->capacity = 0;
+      view->nodes = NULL;
+      graph->sorted_adjacency = view;
+   }
+   if(index >= view->capacity)
+   {
+      int old_capacity = view->capacity;
+      view->capacity = graph->nodes.capacity > index ? graph->nodes.capacity : index + 1;
+      view->nodes = realloc(view->nodes, view->capacity * sizeof(NodeAdjacency));
+      if(view->nodes == NULL)
+      {
+         print_to_log("Error (getNodeAdjacency): malloc failure.\n");
+         exit(1);
+      }
+      int node;
+      for(node = old_capacity; node < view->capacity; node++)
+      {
+         view->nodes[node].valid = false;
+         view->nodes[node].out.size = 0;
+         view->nodes[node].out.items = NULL;
+         view->nodes[node].in.size = 0;
+         view->nodes[node].in.items = NULL;
+      }
+   }
+   NodeAdjacency *adjacency = &(view->nodes[index]);
+   if(!adjacency->valid)
+   {
+      Node *node = getNode(graph, index);
+      buildNeighbourList(graph, node, &(adjacency->out), true);
+      buildNeighbourList(graph, node, &(adjacency->in), false);
+      adjacency->valid = true;
+   }
+   return adjacency;
+}
+
+NeighbourList getOutNeighbours(Graph *graph, int index)
+{
+   return getNodeAdjacency(graph, index)->out;
+}
+
+NeighbourList getInNeighbours(Graph *graph, int index)
+{
+   return getNodeAdjacency(graph, index)->in;
+}
+
+void invalidateSortedAdjacency(Graph *graph, int index)
+{
+   SortedAdjacency *view = graph->sorted_adjacency;
+   if(view != NULL && index < view->capacity) view->nodes[index].valid = false;
+}
+
+void freeSortedAdjacency(Graph *graph)
+{
+   SortedAdjacency *view = graph->sorted_adjacency;
+   if(view == NULL) return;
+   int index;
+   for(index = 0; index < view->capacity; index++)
+   {
+      if(view->nodes[index].out.items != NULL) free(view->nodes[index].out.items);
+      if(view->nodes[index].in.items != NULL) free(view->nodes[index].in.items);
+   }
+   if(view->nodes != NULL) free(view->nodes);
+   free(view);
+   graph->sorted_adjacency = NULL;
+}
+
+void initLeapfrog(Leapfrog *join)
+{
+   join->count = 0;
+   join->last = -1;
+}
+
+void addLeapfrogNode(Leapfrog *join, Graph *graph, int index, bool outgoing)
+{
+   if(index < 0 || join->count == MAX_JOIN_LISTS) return;
+   join->lists[join->count] = outgoing ? getOutNeighbours(graph, index) :
+                                         getInNeighbours(graph, index);
+   join->positions[join->count] = 0;
+   join->count++;
+}
+
+/* Returns the first position at or after position whose node is at least value. */
+static int seek(NeighbourList *list, int position, int value)
+{
+   int high = list->size;
+   while(position < high)
+   {
+      int middle = position + (high - position) / 2;
+      if(list->items[middle].node < value) position = middle + 1;
+      else high = middle;
+   }
+   return position;
+}
+
+int nextLeapfrogNode(Leapfrog *join)
+{
+   if(join->count == 0) return -1;
+   /* The lists are visited in turn. Each list is advanced to the current
+    * candidate; a list whose next node is larger makes that node the new
+    * candidate. The candidate is returned once every list agrees on it. */
+   int value = join->last + 1, agreed = 0, list = 0;
+   while(agreed < join->count)
+   {
+      NeighbourList *neighbours = &(join->lists[list]);
+      join->positions[list] = seek(neighbours, join->positions[list], value);
+      if(join->positions[list] == neighbours->size) return -1;
+      int node = neighbours->items[join->positions[list]].node;
+      if(node == value) agreed++;
+      else
+      {
+         value = node;
+         agreed = 1;
+      }
+      list = (list + 1) % join->count;
+   }
+   join->last = value;
+   return value;
+}
+
+long adjacency_bitmap_budget = DEFAULT_BITMAP_BUDGET;
+
+/* Returns the bitmap of the graph with the given dimension, built from the
+ * edge array, or NULL if it does not fit within the budget. */
+static AdjacencyBitmap *makeAdjacencyBitmap(Graph *graph, int dimension)
+{
+   int row_words = (dimension + 63) / 64;
+   long size = (long)dimension * row_words * (long)sizeof(unsigned long long);
+   if(size > adjacency_bitmap_budget) return NULL;
+   AdjacencyBitmap *bitmap = malloc(sizeof(AdjacencyBitmap));
+   if(bitmap == NULL)
+   {
+      print_to_log("Error (makeAdjacencyBitmap): malloc failure.\n");
+      exit(1);
+   }
+   bitmap->dimension = dimension;
+   bitmap->row_words = row_words;
+   bitmap->bits = calloc((size_t)dimension * row_words, sizeof(unsigned long long));
+   if(bitmap->bits == NULL)
+   {
+      print_to_log("Error (makeAdjacencyBitmap): malloc failure.\n");
+      exit(1);
+   }
+   int index;
+   for(index = 0; index < graph->edges.size; index++)
+   {
+      Edge *edge = getEdge(graph, index);
+      if(edge == NULL || edge->index == -1) continue;
+      bitmap->bits[(long)edge->source * row_words + edge->target / 64] |=
+         1ULL << (edge->target % 64);
+   }
+   return bitmap;
+}
+
+bool mayBeAdjacent(Graph *graph, int source, int target)
+{
+   AdjacencyBitmap *bitmap = graph->adjacency_bitmap;
+   if(bitmap == NULL)
+   {
+      if(adjacency_bitmap_budget == 0) return true;
+      bitmap = makeAdjacencyBitmap(graph, graph->nodes.capacity);
+      if(bitmap == NULL) return true;
+      graph->adjacency_bitmap = bitmap;
+   }
+   /* Nodes outside the bitmap have no edges: adding an edge to one of them
+    * resizes the bitmap. */
+   if(source >= bitmap->dimension || target >= bitmap->dimension) return false;
+   return (bitmap->bits[(long)source * bitmap->row_words + target / 64] >>
+           (target % 64)) & 1;
+}
+
+void addAdjacency(Graph *graph, int source, int target)
+{
+   AdjacencyBitmap *bitmap = graph->adjacency_bitmap;
+   if(bitmap == NULL) return;
+   if(source >= bitmap->dimension || target >= bitmap->dimension)
+   {
+      /* Rebuild the bitmap for the larger node array. The new edge is already
+       * in the edge array. If the graph has outgrown the budget, the bitmap
+       * is dropped. */
+      freeAdjacencyBitmap(graph);
+      graph->adjacency_bitmap = makeAdjacencyBitmap(graph, graph->nodes.capacity);
+      return;
+   }
+   bitmap->bits[(long)source * bitmap->row_words + target / 64] |= 1ULL << (target % 64);
+}
+
+void removeAdjacency(Graph *graph, int source, int target)
+{
+   AdjacencyBitmap *bitmap = graph->adjacency_bitmap;
+   if(bitmap == NULL) return;
+   /* The bit is cleared only if no parallel edge remains. */
+   Node *node = getNode(graph, source);
+   int counter;
+   for(counter = 0; counter < node->out_edges.size + 2; counter++)
+   {
+      Edge *edge = getNthOutEdge(graph, node, counter);
+      if(edge != NULL && edge->target == target) return;
+   }
+   bitmap->bits[(long)source * bitmap->row_words + target / 64] &= ~(1ULL << (target % 64));
+}
+
+void freeAdjacencyBitmap(Graph *graph)
+{
+   AdjacencyBitmap *bitmap = graph->adjacency_bitmap;
+   if(bitmap == NULL) return;
+   free(bitmap->bits);
+   free(bitmap);
+   graph->adjacency_bitmap = NULL;
+}
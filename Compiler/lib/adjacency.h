@@ -0,0 +1,123 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ================
+  Adjacency Module
+  ================
+
+  An optional view of a graph in which the outgoing and incoming edges of each
+  node are sorted by the index of the node at their other end. The view of a
+  node is built the first time it is requested and discarded when the node
+  changes (see reportNodeChange in graph.h), so graphs that are never matched
+  with join matching (compiler flag -j) do not pay for it.
+
+  The module also provides a leapfrog join over sorted neighbour lists. It
+  enumerates the nodes that occur in every list in increasing order, seeking
+  forward in each list by binary search instead of testing every neighbour.
+
+  Finally, the module maintains an adjacency bitmap for graphs small enough
+  for a bit per ordered pair of nodes to fit within a memory budget. Generated
+  code asks the bitmap whether two nodes can be adjacent before scanning the
+  edges of one of them.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_ADJACENCY_H
+#define INC_ADJACENCY_H
+
+#include "globals.h"
+#include "graph.h"
+
+typedef struct Neighbour {
+   int node;
+   int edge;
+} Neighbour;
+
+/* The items are sorted by node index, then by edge index. A node occurs once
+ * for each edge between it and the owner of the list. */
+typedef struct NeighbourList {
+   int size;
+   Neighbour *items;
+} NeighbourList;
+
+typedef struct NodeAdjacency {
+   bool valid;
+   NeighbourList out, in;
+} NodeAdjacency;
+
+typedef struct SortedAdjacency {
+   int capacity;
+   NodeAdjacency *nodes;
+} SortedAdjacency;
+
+/* The lists of the targets of the node's outgoing edges and of the sources of
+ * its incoming edges. The lists remain valid until the graph is changed. */
+NeighbourList getOutNeighbours(Graph *graph, int index);
+NeighbourList getInNeighbours(Graph *graph, int index);
+
+/* Called by reportNodeChange. */
+void invalidateSortedAdjacency(Graph *graph, int index);
+void freeSortedAdjacency(Graph *graph);
+
+#define MAX_JOIN_LISTS 8
+
+/* positions[i] is the current position in lists[i]. last is the node most
+ * recently returned by nextLeapfrogNode. */
+typedef struct Leapfrog {
+   int count;
+   NeighbourList lists[MAX_JOIN_LISTS];
+   int positions[MAX_JOIN_LISTS];
+   int last;
+} Leapfrog;
+
+void initLeapfrog(Leapfrog *join);
+/* Adds the out-neighbours (outgoing = true) or in-neighbours of the node to the
+ * join. A negative index or a full join adds nothing, which only weakens the
+ * join. */
+void addLeapfrogNode(Leapfrog *join, Graph *graph, int index, bool outgoing);
+/* Returns the smallest node index greater than the last one returned that
+ * occurs in every list, or -1 if there is none. On return, positions[0] is the
+ * first item of the node in the first list. */
+int nextLeapfrogNode(Leapfrog *join);
+
+/* Bit target of row source is set if the graph has an edge from source to
+ * target. Rows and columns are indexed by node index. A row is row_words words
+ * long. */
+typedef struct AdjacencyBitmap {
+   int dimension;
+   int row_words;
+   unsigned long long *bits;
+} AdjacencyBitmap;
+
+/* The maximum size in bytes of an adjacency bitmap. It is set by the generated
+ * main function if the compiler was passed a budget (flag -a). A budget of 0
+ * disables the bitmap. */
+#define DEFAULT_BITMAP_BUDGET (64L * 1024 * 1024)
+extern long adjacency_bitmap_budget;
+
+/* Returns false if the graph has no edge from source to target. Returns true
+ * if it has, or if the graph is too large for its bitmap to fit within the
+ * budget. The bitmap is built by the first call on a graph that fits. */
+bool mayBeAdjacent(Graph *graph, int source, int target);
+
+/* Called by reportEdgeChange after an edge from source to target is added to
+ * or removed from the graph. */
+void addAdjacency(Graph *graph, int source, int target);
+void removeAdjacency(Graph *graph, int source, int target);
+void freeAdjacencyBitmap(Graph *graph);
+
+#endif /* INC_ADJACENCY_H */
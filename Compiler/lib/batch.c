@@ -0,0 +1,278 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "batch.h"
+#include "hostParser.h"
+#include "workers.h"
+#include <time.h>
+
+/* The initial size of the node and edge arrays of the host graphs, as for a
+ * small host graph compiled into the runtime. */
+#define BATCH_GRAPH_SIZE 128
+
+/* A host graph is read from the file at path, or, if path is NULL, from the
+ * text of the given length. */
+typedef struct Input {
+   string path;
+   char *text;
+   size_t length;
+} Input;
+
+typedef struct Batch {
+   int count, capacity;
+   Input *inputs;
+} Batch;
+
+static void addInput(Batch *batch, string path, char *text, size_t length)
+{
+   if(batch->count == batch->capacity)
+   {
+      batch->capacity = batch->capacity == 0 ? 64 : 2 * batch->capacity;
+      batch->inputs = realloc(batch->inputs, batch->capacity * sizeof(Input));
+      if(batch->inputs == NULL)
+      {
+         print_to_log("Error (addInput): malloc failure.\n");
+         exit(1);
+      }
+   }
+   Input *input = &(batch->inputs[batch->count++]);
+   input->path = path;
+   input->text = text;
+   input->length = length;
+}
+
+static int compareInputs(const void *first, const void *second)
+{
+   return strcmp(((const Input *)first)->path, ((const Input *)second)->path);
+}
+
+static bool readDirectory(Batch *batch, string name)
+{
+   DIR *directory = opendir(name);
+   if(directory == NULL) return false;
+   struct dirent *entry;
+   while((entry = readdir(directory)) != NULL)
+   {
+      if(entry->d_name[0] == '.') continue;
+      string path = malloc(strlen(name) + strlen(entry->d_name) + 2);
+      if(path == NULL)
+      {
+         print_to_log("Error (readDirectory): malloc failure.\n");
+         exit(1);
+      }
+      sprintf(path, "%s/%s", name, entry->d_name);
+      struct stat status;
+      if(stat(path, &status) == 0 && S_ISREG(status.st_mode)) addInput(batch, path, NULL, 0);
+      else free(path);
+   }
+   closedir(directory);
+   qsort(batch->inputs, batch->count, sizeof(Input), compareInputs);
+   return true;
+}
+
+static void readManifest(Batch *batch, FILE *manifest)
+{
+   char *line = NULL;
+   size_t capacity = 0;
+   ssize_t length;
+   while((length = getline(&line, &capacity, manifest)) > 0)
+   {
+      while(length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+         line[--length] = '\0';
+      if(length > 0) addInput(batch, strdup(line), NULL, 0);
+   }
+   free(line);
+}
+
+/* Reads the stream and splits it after the bracket that closes each graph.
+ * Brackets in strings and comments are skipped. Returns the text, which the
+ * inputs point into. */
+static char *readStream(Batch *batch, FILE *stream)
+{
+   size_t length = 0, capacity = 65536;
+   char *text = malloc(capacity);
+   size_t count;
+   while(text != NULL && (count = fread(text + length, 1, capacity - length, stream)) > 0)
+   {
+      length += count;
+      if(length == capacity) text = realloc(text, capacity *= 2);
+   }
+   if(text == NULL)
+   {
+      print_to_log("Error (readStream): malloc failure.\n");
+      exit(1);
+   }
+   size_t start = 0, position;
+   bool in_graph = false, in_string = false, in_comment = false;
+   for(position = 0; position < length; position++)
+   {
+      char character = text[position];
+      if(in_comment) in_comment = character != '\n';
+      else if(in_string) in_string = character != '"';
+      else if(character == '"') in_string = true;
+      else if(character == '/' && position + 1 < length && text[position + 1] == '/')
+         in_comment = true;
+      else if(character == '[') in_graph = true;
+      else if(character == ']' && in_graph)
+      {
+         addInput(batch, NULL, text + start, position + 1 - start);
+         start = position + 1;
+         in_graph = false;
+      }
+   }
+   /* An unterminated graph is passed to the parser, which reports it. */
+   if(in_graph) addInput(batch, NULL, text + start, length - start);
+   return text;
+}
+
+/* The data shared by the workers. */
+typedef struct BatchWork {
+   Batch *batch;
+   BatchProgram program;
+} BatchWork;
+
+/* Runs the program on inputs w, w + workers, and so on, and appends their
+ * outputs to the worker's file. Each output is preceded by a line holding 1 if
+ * the program produced an output graph or 0, and the length of the output. */
+static void runWorker(int worker, int workers, FILE **files, void *data)
+{
+   Batch *batch = ((BatchWork *)data)->batch;
+   BatchProgram program = ((BatchWork *)data)->program;
+   FILE *results = files[0];
+   int index;
+   for(index = worker; index < batch->count; index += workers)
+   {
+      Input *input = &(batch->inputs[index]);
+      char *output = NULL;
+      size_t size = 0;
+      FILE *stream = open_memstream(&output, &size);
+      if(stream == NULL)
+      {
+         print_to_log("Error (runBatch): malloc failure.\n");
+         exit(1);
+      }
+      FILE *file = input->path == NULL ? fmemopen(input->text, input->length, "r")
+                                       : fopen(input->path, "r");
+      bool produced = false;
+      if(file == NULL)
+      {
+         if(input->path != NULL) perror(input->path);
+         fprintf(stream, "No output graph: host graph %d could not be read.\n", index);
+      }
+      else
+      {
+         Graph *graph = parseHostGraph(file, BATCH_GRAPH_SIZE, BATCH_GRAPH_SIZE);
+         fclose(file);
+         if(graph == NULL)
+            fprintf(stream, "No output graph: host graph %d is invalid.\n", index);
+         else produced = program(stream);
+         /* The program may have replaced the parsed graph. */
+         freeGraph(host);
+         host = NULL;
+      }
+      fclose(stream);
+      fprintf(results, "%d %zu\n", produced ? 1 : 0, size);
+      fwrite(output, 1, size, results);
+      free(output);
+   }
+}
+
+int runBatch(int argc, char **argv, BatchProgram program)
+{
+   int workers = 1, argv_index = 1;
+   if(argc == 4 && strcmp(argv[1], "-w") == 0)
+   {
+      workers = atoi(argv[2]);
+      if(workers < 1)
+      {
+         fprintf(stderr, "Error: invalid worker count \"%s\".\n", argv[2]);
+         return 1;
+      }
+      argv_index = 3;
+   }
+   if(argc - argv_index != 1)
+   {
+      fprintf(stderr, "Usage: %s [-w <workers>] <directory | manifest | ->\n", argv[0]);
+      return 1;
+   }
+
+   string source = argv[argv_index];
+   struct timespec start, finish;
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   Batch batch = {0, 0, NULL};
+   char *text = NULL;
+   if(strcmp(source, "-") == 0) text = readStream(&batch, stdin);
+   else if(!readDirectory(&batch, source))
+   {
+      FILE *manifest = fopen(source, "r");
+      if(manifest == NULL)
+      {
+         perror(source);
+         return 1;
+      }
+      readManifest(&batch, manifest);
+      fclose(manifest);
+   }
+   FILE *output_file = fopen("gp2.output", "w");
+   if(output_file == NULL)
+   {
+      perror("gp2.output");
+      exit(1);
+   }
+
+   if(workers > batch.count) workers = batch.count > 0 ? batch.count : 1;
+   FILE *results[workers];
+   BatchWork work = {&batch, program};
+   runWorkers(workers, 1, results, runWorker, &work, "batch");
+
+   /* Copy the outputs in input order: input i was run by worker i % workers. */
+   int index, produced_count = 0;
+   for(index = 0; index < batch.count; index++)
+   {
+      FILE *file = results[index % workers];
+      int produced;
+      size_t size;
+      if(fscanf(file, "%d %zu", &produced, &size) != 2 || getc(file) != '\n')
+      {
+         print_to_log("Error (runBatch): missing output of host graph %d.\n", index);
+         fprintf(stderr, "Error: missing output of host graph %d.\n", index);
+         exit(1);
+      }
+      produced_count += produced;
+      char buffer[4096];
+      while(size > 0)
+      {
+         size_t count = fread(buffer, 1, size < sizeof(buffer) ? size : sizeof(buffer), file);
+         if(count == 0) break;
+         fwrite(buffer, 1, count, output_file);
+         size -= count;
+      }
+   }
+   int worker;
+   for(worker = 0; worker < workers; worker++) fclose(results[worker]);
+   fclose(output_file);
+
+   clock_gettime(CLOCK_MONOTONIC, &finish);
+   double seconds = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+   printf("Processed %d host graphs (%d output graphs) with %d worker%s in %.3f seconds: "
+          "%.1f graphs per second.\n", batch.count, produced_count, workers,
+          workers == 1 ? "" : "s", seconds, seconds > 0 ? batch.count / seconds : 0.0);
+   printf("Output graphs saved to file gp2.output\n");
+
+   for(index = 0; index < batch.count; index++) free(batch.inputs[index].path);
+   free(batch.inputs);
+   free(text);
+   return 0;
+}
@@ -0,0 +1,55 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ============
+  Batch Module
+  ============
+
+  Runs the compiled program on many host graphs in one execution of the
+  runtime, which is started as
+
+  gp2run [-w <workers>] <source>
+
+  The source is a directory, whose regular files are read in order of their
+  names, a manifest file listing the paths of the host graphs one per line,
+  or - for a stream of concatenated host graphs on standard input. The host
+  graph whose path is compiled into the runtime is not used.
+
+  The host graphs are divided among the given number of worker processes (1
+  by default, see workers.h). Each worker parses its host graphs one at a time,
+  runs the program on them and appends the outputs to a temporary file. The
+  outputs are then copied to gp2.output in input order, and a summary of the
+  throughput is printed.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_BATCH_H
+#define INC_BATCH_H
+
+#include "globals.h"
+#include "graph.h"
+
+/* Runs the program on the global host graph and prints the output graph, or
+ * the reason why there is none, to the output file. Returns false if the
+ * program failed. */
+typedef bool (*BatchProgram)(FILE *output);
+
+/* Called with the arguments of the runtime's main function. Returns the exit
+ * status of the runtime. */
+int runBatch(int argc, char **argv, BatchProgram program);
+
+#endif /* INC_BATCH_H */
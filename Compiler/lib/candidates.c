@@ -0,0 +1,149 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "candidates.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+   #define VECTOR_FILTER
+   #include <immintrin.h>
+#endif
+
+/* The filter parameters, with the degrees clamped to the range of the
+ * summaries. */
+typedef struct Filter {
+   MarkType mark;
+   unsigned char indegree, outdegree, degree;
+} Filter;
+
+static bool scalarTest(NodeSummaries *summaries, int index, Filter *filter)
+{
+   unsigned char mark = summaries->marks[index];
+   if(mark == HOLE_MARK) return false;
+   if(filter->mark == ANY)
+   {
+      if(mark == 0) return false;
+   }
+   else if(filter->mark != EVERY_MARK && mark != filter->mark) return false;
+   unsigned char indegree = summaries->indegrees[index];
+   unsigned char outdegree = summaries->outdegrees[index];
+   if(indegree < filter->indegree || outdegree < filter->outdegree) return false;
+   return indegree + outdegree >= filter->degree;
+}
+
+#ifdef VECTOR_FILTER
+/* Appends the indices of the set bits of the mask, offset by base. */
+static int addCandidates(unsigned int mask, int base, int *candidates, int count)
+{
+   while(mask != 0)
+   {
+      candidates[count++] = base + __builtin_ctz(mask);
+      mask &= mask - 1;
+   }
+   return count;
+}
+
+/* Returns a bit mask of the 16 nodes starting at index that pass the filter. */
+static unsigned int sse2Test(NodeSummaries *summaries, int index, Filter *filter)
+{
+   __m128i marks = _mm_loadu_si128((__m128i *)(summaries->marks + index));
+   __m128i in = _mm_loadu_si128((__m128i *)(summaries->indegrees + index));
+   __m128i out = _mm_loadu_si128((__m128i *)(summaries->outdegrees + index));
+   __m128i pass;
+   if(filter->mark == ANY)
+   {
+      __m128i fail = _mm_or_si128(_mm_cmpeq_epi8(marks, _mm_setzero_si128()),
+                                  _mm_cmpeq_epi8(marks, _mm_set1_epi8((char)HOLE_MARK)));
+      pass = _mm_andnot_si128(fail, _mm_set1_epi8(-1));
+   }
+   else if(filter->mark == EVERY_MARK)
+      pass = _mm_andnot_si128(_mm_cmpeq_epi8(marks, _mm_set1_epi8((char)HOLE_MARK)),
+                              _mm_set1_epi8(-1));
+   else pass = _mm_cmpeq_epi8(marks, _mm_set1_epi8((char)filter->mark));
+   /* An unsigned byte x is at least k if max(x, k) = x. */
+   __m128i bound = _mm_set1_epi8((char)filter->indegree);
+   pass = _mm_and_si128(pass, _mm_cmpeq_epi8(_mm_max_epu8(in, bound), in));
+   bound = _mm_set1_epi8((char)filter->outdegree);
+   pass = _mm_and_si128(pass, _mm_cmpeq_epi8(_mm_max_epu8(out, bound), out));
+   __m128i degree = _mm_adds_epu8(in, out);
+   bound = _mm_set1_epi8((char)filter->degree);
+   pass = _mm_and_si128(pass, _mm_cmpeq_epi8(_mm_max_epu8(degree, bound), degree));
+   return (unsigned int)_mm_movemask_epi8(pass);
+}
+
+/* Returns a bit mask of the 32 nodes starting at index that pass the filter.
+ * Only called if the processor supports AVX2. */
+__attribute__((target("avx2")))
+static unsigned int avx2Test(NodeSummaries *summaries, int index, Filter *filter)
+{
+   __m256i marks = _mm256_loadu_si256((__m256i *)(summaries->marks + index));
+   __m256i in = _mm256_loadu_si256((__m256i *)(summaries->indegrees + index));
+   __m256i out = _mm256_loadu_si256((__m256i *)(summaries->outdegrees + index));
+   __m256i pass;
+   if(filter->mark == ANY)
+   {
+      __m256i hole = _mm256_set1_epi8((char)HOLE_MARK);
+      __m256i fail = _mm256_or_si256(_mm256_cmpeq_epi8(marks, _mm256_setzero_si256()),
+                                     _mm256_cmpeq_epi8(marks, hole));
+      pass = _mm256_andnot_si256(fail, _mm256_set1_epi8(-1));
+   }
+   else if(filter->mark == EVERY_MARK)
+      pass = _mm256_andnot_si256(_mm256_cmpeq_epi8(marks, _mm256_set1_epi8((char)HOLE_MARK)),
+                                 _mm256_set1_epi8(-1));
+   else pass = _mm256_cmpeq_epi8(marks, _mm256_set1_epi8((char)filter->mark));
+   __m256i bound = _mm256_set1_epi8((char)filter->indegree);
+   pass = _mm256_and_si256(pass, _mm256_cmpeq_epi8(_mm256_max_epu8(in, bound), in));
+   bound = _mm256_set1_epi8((char)filter->outdegree);
+   pass = _mm256_and_si256(pass, _mm256_cmpeq_epi8(_mm256_max_epu8(out, bound), out));
+   __m256i degree = _mm256_adds_epu8(in, out);
+   bound = _mm256_set1_epi8((char)filter->degree);
+   pass = _mm256_and_si256(pass,
+                           _mm256_cmpeq_epi8(_mm256_max_epu8(degree, bound), degree));
+   return (unsigned int)_mm256_movemask_epi8(pass);
+}
+
+/* 1 if the processor supports AVX2, 0 if not, -1 if not yet tested. */
+static int avx2_supported = -1;
+#endif
+
+static unsigned char clamp(int degree)
+{
+   if(degree < 0) return 0;
+   return degree > 255 ? 255 : degree;
+}
+
+int filterNodes(Graph *graph, int start, MarkType mark, int indegree,
+                int outdegree, int degree, int *candidates)
+{
+   NodeSummaries *summaries = &(graph->summaries);
+   Filter filter = {mark, clamp(indegree), clamp(outdegree), clamp(degree)};
+   int end = start + FILTER_BLOCK;
+   if(end > graph->nodes.size) end = graph->nodes.size;
+   int index = start, count = 0;
+   #ifdef VECTOR_FILTER
+      if(avx2_supported < 0) avx2_supported = __builtin_cpu_supports("avx2") ? 1 : 0;
+      if(avx2_supported)
+      {
+         for(; index + 32 <= end; index += 32)
+            count = addCandidates(avx2Test(summaries, index, &filter), index,
+                                  candidates, count);
+      }
+      for(; index + 16 <= end; index += 16)
+         count = addCandidates(sse2Test(summaries, index, &filter), index,
+                               candidates, count);
+   #endif
+   for(; index < end; index++)
+      if(scalarTest(summaries, index, &filter)) candidates[count++] = index;
+   return count;
+}
@@ -0,0 +1,60 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  =======================
+  Candidate Filter Module
+  =======================
+
+  Used by the matching functions of rule nodes matched in isolation. Instead of
+  testing every host node in turn, the node array is processed in blocks: the
+  mark and degree tests of each block are run on the packed node summaries of
+  the graph (see NodeSummaries in graph.h), and only the nodes that pass are
+  handed to the generated code for the remaining tests and label matching.
+
+  On x86 processors the summaries are tested 32 nodes at a time with AVX2
+  instructions if the processor supports them, and 16 nodes at a time with
+  SSE2 instructions otherwise. On other processors a scalar loop is used.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_CANDIDATES_H
+#define INC_CANDIDATES_H
+
+#include "globals.h"
+#include "graph.h"
+
+/* The number of nodes processed by one call to filterNodes, and hence the
+ * size of the candidate array passed to it. */
+#define FILTER_BLOCK 128
+
+/* Passed to filterNodes as the mark to skip the mark test. */
+#define EVERY_MARK (ANY + 1)
+
+/* Tests the nodes with indices from start to start + FILTER_BLOCK - 1 (or to
+ * the end of the node array) and writes the indices of the nodes that pass, in
+ * ascending order, to the candidates array. Returns the number of candidates.
+ * A node passes if it is not a hole, its mark is equal to the passed mark (or
+ * is not 0 if the passed mark is ANY, or is any mark if the passed mark is
+ * EVERY_MARK), its indegree and outdegree are at least
+ * the passed values and the sum of its degrees is at least the passed degree.
+ * Degrees are saturated at 255, so the test may pass a node with very high
+ * degree that the generated code then rejects; it never rejects a node that
+ * the generated code would accept. */
+int filterNodes(Graph *graph, int start, MarkType mark, int indegree,
+                int outdegree, int degree, int *candidates);
+
+#endif /* INC_CANDIDATES_H */
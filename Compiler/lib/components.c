@@ -0,0 +1,287 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "components.h"
+#include "workers.h"
+
+/* The nodes of component c are members[starts[c]] to members[starts[c + 1] - 1],
+ * in increasing order of index. edge_counts[c] is the number of edges of
+ * component c. copies maps the index of a host node to the index of its copy
+ * in the graph of its component. */
+typedef struct Partition {
+   int count;
+   int *starts;
+   int *members;
+   int *edge_counts;
+   int *copies;
+} Partition;
+
+/* A worker writes each node of its results as a line holding 1 for a root
+ * node or 0, and its label. Each edge is a line holding the numbers of its
+ * source and target in the node file of the worker, and its label. */
+typedef struct Fragment {
+   FILE *nodes, *edges;
+   int node_count, edge_count;
+} Fragment;
+
+/* The data shared by the workers. */
+typedef struct ComponentWork {
+   Graph *graph;
+   ComponentProgram program;
+   Partition *partition;
+} ComponentWork;
+
+static void *allocate(size_t size)
+{
+   void *pointer = malloc(size > 0 ? size : 1);
+   if(pointer == NULL)
+   {
+      print_to_log("Error (runOnComponents): malloc failure.\n");
+      exit(1);
+   }
+   return pointer;
+}
+
+/* Numbers the components in increasing order of their smallest node index
+ * with a depth-first search from each unvisited node. */
+static Partition partitionGraph(Graph *graph)
+{
+   Partition partition;
+   int size = graph->nodes.size;
+   int *component_of = allocate(size * sizeof(int));
+   int *stack = allocate(size * sizeof(int));
+   int index, count = 0;
+   for(index = 0; index < size; index++) component_of[index] = -1;
+   for(index = 0; index < size; index++)
+   {
+      if(getNode(graph, index)->index == -1 || component_of[index] >= 0) continue;
+      int top = 0;
+      stack[top++] = index;
+      component_of[index] = count;
+      while(top > 0)
+      {
+         Node *node = getNode(graph, stack[--top]);
+         int counter;
+         for(counter = 0; counter < node->out_edges.size + 2; counter++)
+         {
+            Edge *edge = getNthOutEdge(graph, node, counter);
+            if(edge == NULL || component_of[edge->target] >= 0) continue;
+            component_of[edge->target] = count;
+            stack[top++] = edge->target;
+         }
+         for(counter = 0; counter < node->in_edges.size + 2; counter++)
+         {
+            Edge *edge = getNthInEdge(graph, node, counter);
+            if(edge == NULL || component_of[edge->source] >= 0) continue;
+            component_of[edge->source] = count;
+            stack[top++] = edge->source;
+         }
+      }
+      count++;
+   }
+   free(stack);
+
+   partition.count = count;
+   partition.starts = allocate((count + 1) * sizeof(int));
+   partition.members = allocate(graph->number_of_nodes * sizeof(int));
+   partition.edge_counts = allocate(count * sizeof(int));
+   partition.copies = allocate(size * sizeof(int));
+   memset(partition.starts, 0, (count + 1) * sizeof(int));
+   memset(partition.edge_counts, 0, count * sizeof(int));
+   for(index = 0; index < size; index++)
+   {
+      if(component_of[index] < 0) continue;
+      partition.starts[component_of[index] + 1]++;
+      partition.edge_counts[component_of[index]] += getNode(graph, index)->outdegree;
+   }
+   int component;
+   for(component = 0; component < count; component++)
+      partition.starts[component + 1] += partition.starts[component];
+   /* Fill each component from its start, using copies as the fill positions. */
+   for(component = 0; component < count; component++)
+      partition.copies[component] = partition.starts[component];
+   for(index = 0; index < size; index++)
+      if(component_of[index] >= 0)
+         partition.members[partition.copies[component_of[index]]++] = index;
+   free(component_of);
+   return partition;
+}
+
+static Graph *copyComponent(Graph *graph, Partition *partition, int component)
+{
+   int first = partition->starts[component], last = partition->starts[component + 1];
+   int nodes = last - first, edges = partition->edge_counts[component];
+   /* The arrays of a graph grow by doubling, so they cannot start empty. */
+   Graph *copy = newGraph(nodes < 16 ? 16 : nodes, edges < 16 ? 16 : edges);
+   int member;
+   for(member = first; member < last; member++)
+   {
+      Node *node = getNode(graph, partition->members[member]);
+      HostLabel label = node->label;
+      #ifdef LIST_HASHING
+         addHostList(label.list);
+      #else
+         label.list = copyHostList(label.list);
+      #endif
+      partition->copies[node->index] = addNode(copy, node->root, label);
+   }
+   for(member = first; member < last; member++)
+   {
+      Node *node = getNode(graph, partition->members[member]);
+      int counter;
+      for(counter = 0; counter < node->out_edges.size + 2; counter++)
+      {
+         Edge *edge = getNthOutEdge(graph, node, counter);
+         if(edge == NULL) continue;
+         HostLabel label = edge->label;
+         #ifdef LIST_HASHING
+            addHostList(label.list);
+         #else
+            label.list = copyHostList(label.list);
+         #endif
+         addEdge(copy, label, partition->copies[edge->source],
+                 partition->copies[edge->target]);
+      }
+   }
+   return copy;
+}
+
+static void writeFragment(Graph *graph, Fragment *fragment)
+{
+   int index;
+   /* Maps a node's graph-index to its number in the node file. */
+   int *numbers = allocate(graph->nodes.size * sizeof(int));
+   for(index = 0; index < graph->nodes.size; index++)
+   {
+      Node *node = getNode(graph, index);
+      if(node->index == -1) continue;
+      numbers[index] = fragment->node_count++;
+      fprintf(fragment->nodes, "%d ", node->root ? 1 : 0);
+      printHostLabel(node->label, fragment->nodes);
+      fprintf(fragment->nodes, "\n");
+   }
+   for(index = 0; index < graph->edges.size; index++)
+   {
+      Edge *edge = getEdge(graph, index);
+      if(edge->index == -1) continue;
+      fprintf(fragment->edges, "%d %d ", numbers[edge->source], numbers[edge->target]);
+      printHostLabel(edge->label, fragment->edges);
+      fprintf(fragment->edges, "\n");
+   }
+   free(numbers);
+}
+
+/* Worker w runs the program on components w, w + workers, and so on. Its
+ * files are the node file and the edge file of its fragment. */
+static void runWorker(int worker, int workers, FILE **files, void *data)
+{
+   ComponentWork *work = data;
+   Fragment fragment = {files[0], files[1], 0, 0};
+   int component;
+   for(component = worker; component < work->partition->count; component += workers)
+   {
+      Graph *copy = copyComponent(work->graph, work->partition, component);
+      Graph *result = work->program(copy);
+      writeFragment(result, &fragment);
+      freeGraph(result);
+   }
+}
+
+/* Counts the lines of a fragment file and rewinds it. */
+static int rewindFragment(FILE *file)
+{
+   int count = 0, character;
+   rewind(file);
+   while((character = getc(file)) != EOF)
+      if(character == '\n') count++;
+   rewind(file);
+   return count;
+}
+
+void runOnComponents(Graph *graph, ComponentProgram program, int workers, FILE *output)
+{
+   Partition partition = partitionGraph(graph);
+   if(workers > partition.count) workers = partition.count > 0 ? partition.count : 1;
+   FILE *files[2 * workers];
+   ComponentWork work = {graph, program, &partition};
+   runWorkers(workers, 2, files, runWorker, &work, "component");
+   free(partition.starts);
+   free(partition.members);
+   free(partition.edge_counts);
+   free(partition.copies);
+
+   /* The counts of the workers that were forked are only known to the files. */
+   Fragment fragments[workers];
+   int nodes = 0, edges = 0;
+   int offsets[workers];
+   int worker;
+   for(worker = 0; worker < workers; worker++)
+   {
+      offsets[worker] = nodes;
+      fragments[worker].nodes = files[2 * worker];
+      fragments[worker].edges = files[2 * worker + 1];
+      fragments[worker].node_count = rewindFragment(fragments[worker].nodes);
+      fragments[worker].edge_count = rewindFragment(fragments[worker].edges);
+      nodes += fragments[worker].node_count;
+      edges += fragments[worker].edge_count;
+   }
+
+   /* Print the union in the format of printGraph. */
+   char *line = NULL;
+   size_t capacity = 0;
+   ssize_t length;
+   int node_count = 0, edge_count = 0;
+   if(nodes == 0) fprintf(output, "[ | ]\n\n");
+   else
+   {
+      fprintf(output, "[ ");
+      for(worker = 0; worker < workers; worker++)
+      {
+         while((length = getline(&line, &capacity, fragments[worker].nodes)) > 0)
+         {
+            if(line[length - 1] == '\n') line[length - 1] = '\0';
+            /* Five nodes per line */
+            if(node_count != 0 && node_count % 5 == 0) fprintf(output, "\n  ");
+            if(line[0] == '1') fprintf(output, "(%d(R), %s) ", node_count++, line + 2);
+            else fprintf(output, "(%d, %s) ", node_count++, line + 2);
+         }
+      }
+      if(edges == 0) fprintf(output, "| ]\n\n");
+      else
+      {
+         fprintf(output, "|\n  ");
+         for(worker = 0; worker < workers; worker++)
+         {
+            while((length = getline(&line, &capacity, fragments[worker].edges)) > 0)
+            {
+               if(line[length - 1] == '\n') line[length - 1] = '\0';
+               int source, target, label = 0;
+               sscanf(line, "%d %d %n", &source, &target, &label);
+               /* Three edges per line */
+               if(edge_count != 0 && edge_count % 3 == 0) fprintf(output, "\n  ");
+               fprintf(output, "(%d, %d, %d, %s) ", edge_count++,
+                       offsets[worker] + source, offsets[worker] + target, line + label);
+            }
+         }
+         fprintf(output, "]\n\n");
+      }
+   }
+   free(line);
+   for(worker = 0; worker < workers; worker++)
+   {
+      fclose(fragments[worker].nodes);
+      fclose(fragments[worker].edges);
+   }
+}
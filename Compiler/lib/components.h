@@ -0,0 +1,53 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  =================
+  Components Module
+  =================
+
+  Runs component-local programs (see isComponentLocal in the compiler's
+  analysis module) on each connected component of the host graph separately
+  (compiler flag -C). Such programs never match across components, so the
+  union of their results on the components is a result of the program on the
+  whole host graph.
+
+  The components are divided among worker processes (see workers.h). Each
+  worker copies its components out of the host graph one at a
+  time, runs the program on the copy, and appends the result to temporary
+  files before freeing it. The parent process then streams the results of the
+  workers into the output file. Neither the workers nor the parent hold more
+  than the host graph and one component at a time.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_COMPONENTS_H
+#define INC_COMPONENTS_H
+
+#include "globals.h"
+#include "graph.h"
+
+/* Runs the program on the passed component and returns the resulting graph,
+ * which is freed by the caller. */
+typedef Graph *(*ComponentProgram)(Graph *component);
+
+/* Runs the program on each connected component of the graph with the given
+ * number of worker processes, and prints the union of the results to the
+ * output file in the format of printGraph. The nodes and edges of the output
+ * are grouped by worker, then by component. The graph is not changed. */
+void runOnComponents(Graph *graph, ComponentProgram program, int workers, FILE *output);
+
+#endif /* INC_COMPONENTS_H */
@@ -14,11 +14,15 @@
   along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "graph.h"
+#include "adjacency.h"
+#include <pthread.h>
 
 Node dummy_node = {-1, false, {NONE, 0, NULL}, 0, 0, -1, -1, -1, -1, 
                    {0, 0, NULL}, {0, 0, NULL}, false};
 Edge dummy_edge = {-1, {NONE, 0, NULL}, -1, -1, false};
 
+void (*node_change_hook)(Graph *graph, int index) = NULL;
+
 IntArray makeIntArray(int initial_capacity)
 {
    IntArray array;
@@ -204,6 +208,262 @@ static void removeFromEdgeArray(EdgeArray *array, int index)
    else addToIntArray(&(array->holes), index);
 }
 
+static NodeSummaries makeNodeSummaries(int initial_capacity)
+{
+   NodeSummaries summaries;
+   summaries.capacity = initial_capacity > 0 ? initial_capacity : 16;
+   summaries.marks = malloc(summaries.capacity);
+   summaries.indegrees = malloc(summaries.capacity);
+   summaries.outdegrees = malloc(summaries.capacity);
+   summaries.signatures = malloc(summaries.capacity * sizeof(unsigned long long));
+   summaries.lengths = malloc(summaries.capacity);
+   summaries.roots = malloc(summaries.capacity * sizeof(bool));
+   if(summaries.marks == NULL || summaries.indegrees == NULL || 
+      summaries.outdegrees == NULL || summaries.signatures == NULL ||
+      summaries.lengths == NULL || summaries.roots == NULL)
+   {
+      print_to_log("Error (makeNodeSummaries): malloc failure.\n");
+      exit(1);
+   }
+   memset(summaries.marks, HOLE_MARK, summaries.capacity);
+   return summaries;
+}
+
+static void growNodeSummaries(NodeSummaries *summaries, int index)
+{
+   int old_capacity = summaries->capacity;
+   while(summaries->capacity <= index) summaries->capacity *= 2;
+   summaries->marks = realloc(summaries->marks, summaries->capacity);
+   summaries->indegrees = realloc(summaries->indegrees, summaries->capacity);
+   summaries->outdegrees = realloc(summaries->outdegrees, summaries->capacity);
+   summaries->signatures = realloc(summaries->signatures,
+                                   summaries->capacity * sizeof(unsigned long long));
+   summaries->lengths = realloc(summaries->lengths, summaries->capacity);
+   summaries->roots = realloc(summaries->roots, summaries->capacity * sizeof(bool));
+   if(summaries->marks == NULL || summaries->indegrees == NULL || 
+      summaries->outdegrees == NULL || summaries->signatures == NULL ||
+      summaries->lengths == NULL || summaries->roots == NULL)
+   {
+      print_to_log("Error (growNodeSummaries): malloc failure.\n");
+      exit(1);
+   }
+   memset(summaries->marks + old_capacity, HOLE_MARK, summaries->capacity - old_capacity);
+}
+
+static unsigned char saturate(int degree)
+{
+   return degree > 255 ? 255 : degree;
+}
+
+static unsigned char countedLength(int length)
+{
+   return length < COUNTED_LENGTHS ? length : COUNTED_LENGTHS - 1;
+}
+
+unsigned long change_epoch = 0;
+
+static void touchNodeClass(Graph *graph, int index)
+{
+   NodeSummaries *summaries = &(graph->summaries);
+   if(summaries->marks[index] == HOLE_MARK) return;
+   int node_class = NODE_CLASS(summaries->marks[index], summaries->lengths[index]);
+   graph->class_epochs[node_class] = ++change_epoch;
+}
+
+bool classesChangedSince(Graph *graph, unsigned int classes, unsigned long epoch)
+{
+   int node_class;
+   for(node_class = 0; node_class < NODE_CLASSES; node_class++)
+      if((classes >> node_class) & 1 && graph->class_epochs[node_class] > epoch)
+         return true;
+   return false;
+}
+
+void reportNodeChange(Graph *graph, int index)
+{
+   NodeSummaries *summaries = &(graph->summaries);
+   ElementCounts *counts = &(graph->counts);
+   if(index >= summaries->capacity) growNodeSummaries(summaries, index);
+   /* The summary holds the state of the node when it was last counted. The
+    * classes of both the old and the new state are touched. */
+   touchNodeClass(graph, index);
+   if(summaries->marks[index] != HOLE_MARK)
+   {
+      counts->node_marks[summaries->marks[index]]--;
+      counts->node_lengths[summaries->lengths[index]]--;
+      if(summaries->roots[index]) counts->root_nodes--;
+   }
+   Node *node = &(graph->nodes.items[index]);
+   if(node->index == -1)
+   {
+      summaries->marks[index] = HOLE_MARK;
+      summaries->indegrees[index] = 0;
+      summaries->outdegrees[index] = 0;
+   }
+   else
+   {
+      summaries->marks[index] = node->label.mark;
+      summaries->indegrees[index] = saturate(node->indegree);
+      summaries->outdegrees[index] = saturate(node->outdegree);
+      summaries->lengths[index] = countedLength(node->label.length);
+      summaries->roots[index] = node->root;
+      counts->node_marks[node->label.mark]++;
+      counts->node_lengths[summaries->lengths[index]]++;
+      if(node->root) counts->root_nodes++;
+      touchNodeClass(graph, index);
+   }
+   summaries->signatures[index] = STALE_SIGNATURE;
+   if(graph->sorted_adjacency != NULL) invalidateSortedAdjacency(graph, index);
+   if(node_change_hook != NULL) node_change_hook(graph, index);
+}
+
+static void indexEdge(EdgeMarkIndex *edge_index, int index, MarkType mark)
+{
+   if(index >= edge_index->capacity)
+   {
+      edge_index->capacity = 2 * index + 16;
+      edge_index->positions = realloc(edge_index->positions,
+                                      edge_index->capacity * sizeof(int));
+      if(edge_index->positions == NULL)
+      {
+         print_to_log("Error (indexEdge): malloc failure.\n");
+         exit(1);
+      }
+   }
+   edge_index->positions[index] = edge_index->edges[mark].size;
+   addToIntArray(&(edge_index->edges[mark]), index);
+}
+
+/* Moves the last edge of the array into the position of the removed edge. */
+static void unindexEdge(EdgeMarkIndex *edge_index, int index, MarkType mark)
+{
+   IntArray *edges = &(edge_index->edges[mark]);
+   int position = edge_index->positions[index];
+   int last = edges->items[--edges->size];
+   edges->items[position] = last;
+   edge_index->positions[last] = position;
+}
+
+IntArray *getMarkedEdges(Graph *graph, MarkType mark)
+{
+   EdgeMarkIndex *edge_index = graph->edge_mark_index;
+   if(edge_index == NULL)
+   {
+      edge_index = malloc(sizeof(EdgeMarkIndex));
+      if(edge_index == NULL)
+      {
+         print_to_log("Error (getMarkedEdges): malloc failure.\n");
+         exit(1);
+      }
+      int index;
+      for(index = 0; index < HOST_MARKS; index++)
+         edge_index->edges[index] = makeIntArray(0);
+      edge_index->capacity = 0;
+      edge_index->positions = NULL;
+      for(index = 0; index < graph->edges.size; index++)
+      {
+         Edge *edge = getEdge(graph, index);
+         if(edge == NULL || edge->index == -1) continue;
+         indexEdge(edge_index, index, edge->label.mark);
+      }
+      graph->edge_mark_index = edge_index;
+   }
+   return &(edge_index->edges[mark]);
+}
+
+static void freeEdgeMarkIndex(Graph *graph)
+{
+   EdgeMarkIndex *edge_index = graph->edge_mark_index;
+   if(edge_index == NULL) return;
+   int mark;
+   for(mark = 0; mark < HOST_MARKS; mark++)
+      if(edge_index->edges[mark].items != NULL) free(edge_index->edges[mark].items);
+   if(edge_index->positions != NULL) free(edge_index->positions);
+   free(edge_index);
+   graph->edge_mark_index = NULL;
+}
+
+/* Moves the edge to the array of its new mark. */
+static void remarkIndexedEdge(Graph *graph, int index, MarkType old_mark,
+                              MarkType new_mark)
+{
+   if(graph->edge_mark_index == NULL || old_mark == new_mark) return;
+   unindexEdge(graph->edge_mark_index, index, old_mark);
+   indexEdge(graph->edge_mark_index, index, new_mark);
+}
+
+void reportEdgeChange(Graph *graph, int index, int source, int target,
+                      HostLabel label, bool added)
+{
+   int change = added ? 1 : -1;
+   graph->counts.edge_marks[label.mark] += change;
+   graph->counts.edge_lengths[countedLength(label.length)] += change;
+   if(graph->edge_mark_index != NULL)
+   {
+      if(added) indexEdge(graph->edge_mark_index, index, label.mark);
+      else unindexEdge(graph->edge_mark_index, index, label.mark);
+   }
+   if(added) addAdjacency(graph, source, target);
+   else removeAdjacency(graph, source, target);
+}
+
+static unsigned long long computeSignature(Graph *graph, Node *node)
+{
+   unsigned long long signature = 0;
+   int counter;
+   for(counter = 0; counter < node->out_edges.size + 2; counter++)
+   {
+      Edge *edge = getNthOutEdge(graph, node, counter);
+      if(edge == NULL) continue;
+      signature |= SIGNATURE_BIT(true, edge->label.mark,
+                                 getTarget(graph, edge)->label.mark);
+   }
+   for(counter = 0; counter < node->in_edges.size + 2; counter++)
+   {
+      Edge *edge = getNthInEdge(graph, node, counter);
+      if(edge == NULL) continue;
+      signature |= SIGNATURE_BIT(false, edge->label.mark,
+                                 getSource(graph, edge)->label.mark);
+   }
+   return signature;
+}
+
+bool hasSignature(Graph *graph, int index, unsigned long long required)
+{
+   unsigned long long signature = graph->summaries.signatures[index];
+   if(signature == STALE_SIGNATURE)
+   {
+      signature = computeSignature(graph, getNode(graph, index));
+      /* Threads matching concurrently only read the summaries. */
+      if(!concurrent_matching) graph->summaries.signatures[index] = signature;
+   }
+   return (signature & required) == required;
+}
+
+/* The signatures of a node's neighbours depend on its mark. */
+static void invalidateNeighbourSignatures(Graph *graph, int index)
+{
+   Node *node = getNode(graph, index);
+   int counter;
+   for(counter = 0; counter < node->out_edges.size + 2; counter++)
+   {
+      Edge *edge = getNthOutEdge(graph, node, counter);
+      if(edge != NULL) graph->summaries.signatures[edge->target] = STALE_SIGNATURE;
+   }
+   for(counter = 0; counter < node->in_edges.size + 2; counter++)
+   {
+      Edge *edge = getNthInEdge(graph, node, counter);
+      if(edge != NULL) graph->summaries.signatures[edge->source] = STALE_SIGNATURE;
+   }
+}
+
+/* The signatures of an edge's endpoints depend on its mark. */
+static void invalidateEndpointSignatures(Graph *graph, int index)
+{
+   Edge *edge = getEdge(graph, index);
+   graph->summaries.signatures[edge->source] = STALE_SIGNATURE;
+   graph->summaries.signatures[edge->target] = STALE_SIGNATURE;
+}
 
 /* ===============
  * Graph Functions
@@ -221,6 +481,12 @@ Graph *newGraph(int nodes, int edges)
 
    graph->number_of_nodes = 0;
    graph->number_of_edges = 0;
+   graph->summaries = makeNodeSummaries(nodes);
+   memset(&(graph->counts), 0, sizeof(ElementCounts));
+   memset(graph->class_epochs, 0, sizeof(graph->class_epochs));
+   graph->edge_mark_index = NULL;
+   graph->sorted_adjacency = NULL;
+   graph->adjacency_bitmap = NULL;
    graph->root_nodes = NULL;
    return graph;
 }
@@ -243,6 +509,7 @@ int addNode(Graph *graph, bool root, HostLabel label)
    int index = addToNodeArray(&(graph->nodes), node);
    if(root) addRootNode(graph, index);
    graph->number_of_nodes++;
+   reportNodeChange(graph, index);
    return index; 
 }
 
@@ -284,6 +551,9 @@ int addEdge(Graph *graph, HostLabel label, int source_index, int target_index)
    target->indegree++;
 
    graph->number_of_edges++;
+   reportEdgeChange(graph, index, source_index, target_index, label, true);
+   reportNodeChange(graph, source_index);
+   reportNodeChange(graph, target_index);
    return index; 
 }
 
@@ -299,6 +569,7 @@ void removeNode(Graph *graph, int index)
    
    removeFromNodeArray(&(graph->nodes), index);
    graph->number_of_nodes--;
+   reportNodeChange(graph, index);
 }
 
 void removeRootNode(Graph *graph, int index)
@@ -320,33 +591,44 @@ void removeRootNode(Graph *graph, int index)
 
 void removeEdge(Graph *graph, int index) 
 {
-   Node *source = getNode(graph, graph->edges.items[index].source);
+   int source_index = graph->edges.items[index].source;
+   int target_index = graph->edges.items[index].target;
+   Node *source = getNode(graph, source_index);
    if(source->first_out_edge == index) source->first_out_edge = -1;
    else if(source->second_out_edge == index) source->second_out_edge = -1;
    else removeFromIntArray(&(source->out_edges), index);
    source->outdegree--;
 
-   Node *target = getNode(graph, graph->edges.items[index].target);
+   Node *target = getNode(graph, target_index);
    if(target->first_in_edge == index) target->first_in_edge = -1;
    else if(target->second_in_edge == index) target->second_in_edge = -1;
    else removeFromIntArray(&(target->in_edges), index);
    target->indegree--;
 
-   removeHostList(graph->edges.items[index].label.list);
+   HostLabel label = graph->edges.items[index].label;
+   removeHostList(label.list);
 
    removeFromEdgeArray(&(graph->edges), index);
    graph->number_of_edges--;
+   reportEdgeChange(graph, index, source_index, target_index, label, false);
+   reportNodeChange(graph, source_index);
+   reportNodeChange(graph, target_index);
 }
 
 void relabelNode(Graph *graph, int index, HostLabel new_label) 
 {
+   bool remarked = graph->nodes.items[index].label.mark != new_label.mark;
    removeHostList(graph->nodes.items[index].label.list);
    graph->nodes.items[index].label = new_label;
+   if(remarked) invalidateNeighbourSignatures(graph, index);
+   reportNodeChange(graph, index);
 }
 
 void changeNodeMark(Graph *graph, int index, MarkType new_mark)
 {
    graph->nodes.items[index].label.mark = new_mark;
+   invalidateNeighbourSignatures(graph, index);
+   reportNodeChange(graph, index);
 }
 
 void changeRoot(Graph *graph, int index)
@@ -355,6 +637,7 @@ void changeRoot(Graph *graph, int index)
    if(is_root) removeRootNode(graph, index);
    else addRootNode(graph, index);
    graph->nodes.items[index].root = !is_root;
+   reportNodeChange(graph, index);
 }
 
 void resetMatchedNodeFlag(Graph *graph, int index)
@@ -364,13 +647,28 @@ void resetMatchedNodeFlag(Graph *graph, int index)
 
 void relabelEdge(Graph *graph, int index, HostLabel new_label)
 {	
-   removeHostList(graph->edges.items[index].label.list);
+   HostLabel old_label = graph->edges.items[index].label;
+   removeHostList(old_label.list);
    graph->edges.items[index].label = new_label;
+   graph->counts.edge_marks[old_label.mark]--;
+   graph->counts.edge_lengths[countedLength(old_label.length)]--;
+   graph->counts.edge_marks[new_label.mark]++;
+   graph->counts.edge_lengths[countedLength(new_label.length)]++;
+   remarkIndexedEdge(graph, index, old_label.mark, new_label.mark);
+   if(old_label.mark != new_label.mark) invalidateEndpointSignatures(graph, index);
+   touchNodeClass(graph, graph->edges.items[index].source);
+   touchNodeClass(graph, graph->edges.items[index].target);
 }
 
 void changeEdgeMark(Graph *graph, int index, MarkType new_mark)
 {
+   graph->counts.edge_marks[graph->edges.items[index].label.mark]--;
+   graph->counts.edge_marks[new_mark]++;
+   remarkIndexedEdge(graph, index, graph->edges.items[index].label.mark, new_mark);
    graph->edges.items[index].label.mark = new_mark;
+   invalidateEndpointSignatures(graph, index);
+   touchNodeClass(graph, graph->edges.items[index].source);
+   touchNodeClass(graph, graph->edges.items[index].target);
 }
 
 void resetMatchedEdgeFlag(Graph *graph, int index)
@@ -458,56 +756,292 @@ int getOutdegree(Graph *graph, int index)
    return node->outdegree;
 }
 
-void printGraph(Graph *graph, FILE *file) 
+/* Large graphs are printed in chunks of PRINT_CHUNK_SIZE array entries. The
+ * chunks are formatted into buffers in memory, up to PRINT_ROUND_SIZE chunks
+ * per thread at a time, and the buffers are written to the file in order. */
+#define PRINT_CHUNK_SIZE 65536
+#define PRINT_ROUND_SIZE 4
+
+int print_threads = 0;
+
+typedef struct PrintBuffer {
+   char *text;
+   size_t length, capacity;
+} PrintBuffer;
+
+/* A chunk of the node or edge array, from start to end - 1. first_id is the
+ * ID its first node or edge is printed with, from the prefix sum of the counts
+ * of the earlier chunks. output_indices maps the graph-index of each node to
+ * its ID; it is filled in by the node chunks and read by the edge chunks. */
+typedef struct PrintChunk {
+   Graph *graph;
+   int *output_indices;
+   bool edges;
+   int start, end;
+   int count, first_id;
+   PrintBuffer buffer;
+} PrintChunk;
+
+/* The chunks claimed by the threads of one phase of printGraph. */
+typedef struct PrintPhase {
+   PrintChunk *chunks;
+   int count, next_chunk;
+   void (*routine)(PrintChunk *chunk);
+} PrintPhase;
+
+static void reserveText(PrintBuffer *buffer, size_t length)
 {
-   /* The node and edge counts are used in the IDs of the printed graph. The item's 
-    * index in the graph is not suitable for this purpose because there may be holes
-    * in the graph's node array. The counts are also used to control the number of
-    * nodes and edges printed per line. */
-   int index, node_count = 0, edge_count = 0;
-   if(graph == NULL || graph->number_of_nodes == 0) 
+   if(buffer->length + length <= buffer->capacity) return;
+   size_t capacity = buffer->capacity == 0 ? 4096 : buffer->capacity;
+   while(capacity < buffer->length + length) capacity *= 2;
+   buffer->text = realloc(buffer->text, capacity);
+   if(buffer->text == NULL)
    {
-      PTF("[ | ]\n\n");
-      return;
+      print_to_log("Error (printGraph): malloc failure.\n");
+      exit(1);
    }
-   PTF("[ ");
-   /* Maps a node's graph-index to the ID it is printed with (node_count). */
-   int output_indices[graph->nodes.size];
-   for(index = 0; index < graph->nodes.size; index++)
+   buffer->capacity = capacity;
+}
+
+static void appendText(PrintBuffer *buffer, const char *text, size_t length)
+{
+   reserveText(buffer, length);
+   memcpy(buffer->text + buffer->length, text, length);
+   buffer->length += length;
+}
+
+#define appendString(buffer, literal) appendText(buffer, literal, sizeof(literal) - 1)
+
+/* Formats the integer in decimal, as printf's %d. */
+static void appendInt(PrintBuffer *buffer, int value)
+{
+   char digits[12];
+   int position = sizeof(digits);
+   unsigned int magnitude = value < 0 ? -(unsigned int)value : (unsigned int)value;
+   do
    {
-      Node *node = getNode(graph, index);
-      if(node->index == -1) 
+      digits[--position] = '0' + magnitude % 10;
+      magnitude /= 10;
+   }
+   while(magnitude > 0);
+   if(value < 0) digits[--position] = '-';
+   appendText(buffer, digits + position, sizeof(digits) - position);
+}
+
+/* Formats the label as printHostLabel. */
+static void appendLabel(PrintBuffer *buffer, HostLabel label)
+{
+   if(label.length == 0) appendString(buffer, "empty");
+   else
+   {
+      HostListItem *item;
+      for(item = label.list->first; item != NULL; item = item->next)
+      {
+         if(item->atom.type == 'i') appendInt(buffer, item->atom.num);
+         else
+         {
+            size_t length = strlen(item->atom.str);
+            reserveText(buffer, length + 2);
+            buffer->text[buffer->length] = '"';
+            memcpy(buffer->text + buffer->length + 1, item->atom.str, length);
+            buffer->text[buffer->length + length + 1] = '"';
+            buffer->length += length + 2;
+         }
+         if(item->next != NULL) appendString(buffer, " : ");
+      }
+   }
+   switch(label.mark)
+   {
+      case RED: appendString(buffer, " # red"); break;
+      case GREEN: appendString(buffer, " # green"); break;
+      case BLUE: appendString(buffer, " # blue"); break;
+      case GREY: appendString(buffer, " # grey"); break;
+      case DASHED: appendString(buffer, " # dashed"); break;
+      default: break;
+   }
+}
+
+static void countChunk(PrintChunk *chunk)
+{
+   int index;
+   chunk->count = 0;
+   for(index = chunk->start; index < chunk->end; index++)
+   {
+      if(chunk->edges) chunk->count += getEdge(chunk->graph, index)->index != -1;
+      else chunk->count += getNode(chunk->graph, index)->index != -1;
+   }
+}
+
+static void formatChunk(PrintChunk *chunk)
+{
+   PrintBuffer *buffer = &(chunk->buffer);
+   int index, id = chunk->first_id;
+   for(index = chunk->start; index < chunk->end; index++)
+   {
+      if(chunk->edges)
+      {
+         Edge *edge = getEdge(chunk->graph, index);
+         if(edge->index == -1) continue;
+         /* Three edges per line */
+         if(id != 0 && id % 3 == 0) appendString(buffer, "\n  ");
+         appendString(buffer, "(");
+         appendInt(buffer, id++);
+         appendString(buffer, ", ");
+         appendInt(buffer, chunk->output_indices[edge->source]);
+         appendString(buffer, ", ");
+         appendInt(buffer, chunk->output_indices[edge->target]);
+         appendString(buffer, ", ");
+         appendLabel(buffer, edge->label);
+         appendString(buffer, ") ");
+      }
+      else
       {
-         output_indices[index] = -1;
-         continue; 
+         Node *node = getNode(chunk->graph, index);
+         if(node->index == -1)
+         {
+            chunk->output_indices[index] = -1;
+            continue;
+         }
+         /* Five nodes per line */
+         if(id != 0 && id % 5 == 0) appendString(buffer, "\n  ");
+         chunk->output_indices[index] = id;
+         appendString(buffer, "(");
+         appendInt(buffer, id++);
+         if(node->root) appendString(buffer, "(R), ");
+         else appendString(buffer, ", ");
+         appendLabel(buffer, node->label);
+         appendString(buffer, ") ");
       }
-      /* Five nodes per line */
-      if(node_count != 0 && node_count % 5 == 0) PTF("\n  ");
-      output_indices[index] = node_count;
-      if(node->root) PTF("(%d(R), ", node_count++);
-      else PTF("(%d, ", node_count++);
-      printHostLabel(node->label, file);
-      PTF(") ");
    }
-   if(graph->number_of_edges == 0)
+}
+
+static void *runPrintPhase(void *argument)
+{
+   PrintPhase *phase = argument;
+   int chunk;
+   while((chunk = __atomic_fetch_add(&(phase->next_chunk), 1, __ATOMIC_RELAXED)) < phase->count)
+      phase->routine(&(phase->chunks[chunk]));
+   return NULL;
+}
+
+/* Runs the routine on each of the chunks, on at most the given number of
+ * threads. The calling thread is one of them. */
+static void runPrintChunks(PrintChunk *chunks, int count, void (*routine)(PrintChunk *chunk),
+                           int threads)
+{
+   PrintPhase phase = {chunks, count, 0, routine};
+   if(threads > count) threads = count;
+   if(threads <= 1)
    {
-      PTF("| ]\n\n");
+      runPrintPhase(&phase);
       return;
    }
-   PTF("|\n  ");
-   for(index = 0; index < graph->edges.size; index++)
+   pthread_t handles[threads];
+   bool started[threads];
+   int number;
+   for(number = 1; number < threads; number++)
+      started[number] = pthread_create(&handles[number], NULL, runPrintPhase, &phase) == 0;
+   runPrintPhase(&phase);
+   for(number = 1; number < threads; number++)
+      if(started[number]) pthread_join(handles[number], NULL);
+}
+
+/* Formats the chunks in rounds and writes them to the file in order. */
+static void printChunks(PrintChunk *chunks, int count, int threads, FILE *file)
+{
+   int round = threads * PRINT_ROUND_SIZE, first, index;
+   for(first = 0; first < count; first += round)
    {
-      Edge *edge = getEdge(graph, index);
-      if(edge->index == -1) continue; 
+      int end = first + round < count ? first + round : count;
+      runPrintChunks(chunks + first, end - first, formatChunk, threads);
+      for(index = first; index < end; index++)
+      {
+         fwrite(chunks[index].buffer.text, 1, chunks[index].buffer.length, file);
+         free(chunks[index].buffer.text);
+         chunks[index].buffer.text = NULL;
+      }
+   }
+}
+
+/* Divides the array of the given size into chunks from chunks[0], counts their
+ * nodes or edges and sets their first IDs. */
+static void makePrintChunks(Graph *graph, int *output_indices, bool edges, int size,
+                           PrintChunk *chunks, int threads)
+{
+   int count = 0, start, id = 0;
+   for(start = 0; start < size; start += PRINT_CHUNK_SIZE)
+   {
+      PrintChunk *chunk = &chunks[count++];
+      chunk->graph = graph;
+      chunk->output_indices = output_indices;
+      chunk->edges = edges;
+      chunk->start = start;
+      chunk->end = start + PRINT_CHUNK_SIZE < size ? start + PRINT_CHUNK_SIZE : size;
+      chunk->buffer.text = NULL;
+      chunk->buffer.length = chunk->buffer.capacity = 0;
+   }
+   runPrintChunks(chunks, count, countChunk, threads);
+   for(start = 0; start < count; start++)
+   {
+      chunks[start].first_id = id;
+      id += chunks[start].count;
+   }
+}
 
-      /* Three edges per line */
-      if(edge_count != 0 && edge_count % 3 == 0) PTF("\n  ");
-      PTF("(%d, ", edge_count++);
-      PTF("%d, %d, ", output_indices[edge->source], output_indices[edge->target]);
-      printHostLabel(edge->label, file);
-      PTF(") ");
+void printGraph(Graph *graph, FILE *file) 
+{
+   /* The nodes and edges are printed with consecutive IDs from 0. The item's 
+    * index in the graph is not suitable for this purpose because there may be holes
+    * in the graph's node array. The IDs are also used to control the number of
+    * nodes and edges printed per line. */
+   if(graph == NULL || graph->number_of_nodes == 0) 
+   {
+      fputs("[ | ]\n\n", file);
+      return;
    }
-   PTF("]\n\n");
+   int threads = print_threads;
+   if(threads < 1) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+   if(threads < 1) threads = 1;
+
+   /* Maps a node's graph-index to the ID it is printed with. */
+   int *output_indices = malloc(graph->nodes.size * sizeof(int));
+   int node_chunks = (graph->nodes.size + PRINT_CHUNK_SIZE - 1) / PRINT_CHUNK_SIZE;
+   int edge_chunks = (graph->edges.size + PRINT_CHUNK_SIZE - 1) / PRINT_CHUNK_SIZE;
+   PrintChunk *chunks = malloc((node_chunks + edge_chunks) * sizeof(PrintChunk));
+   if(output_indices == NULL || chunks == NULL)
+   {
+      print_to_log("Error (printGraph): malloc failure.\n");
+      exit(1);
+   }
+   makePrintChunks(graph, output_indices, false, graph->nodes.size, chunks, threads);
+   fputs("[ ", file);
+   printChunks(chunks, node_chunks, threads, file);
+   if(graph->number_of_edges == 0) fputs("| ]\n\n", file);
+   else
+   {
+      /* The edge chunks read the IDs set by all node chunks. */
+      makePrintChunks(graph, output_indices, true, graph->edges.size,
+                      chunks + node_chunks, threads);
+      fputs("|\n  ", file);
+      printChunks(chunks + node_chunks, edge_chunks, threads, file);
+      fputs("]\n\n", file);
+   }
+   free(chunks);
+   free(output_indices);
+}
+
+int touched_nodes[MAX_TOUCHED_NODES];
+int touched_node_count = 0;
+
+void resetTouchedNodes(void)
+{
+   touched_node_count = 0;
+}
+
+void addTouchedNode(int index)
+{
+   if(index < 0 || touched_node_count == MAX_TOUCHED_NODES) return;
+   touched_nodes[touched_node_count++] = index;
 }
 
 void freeGraph(Graph *graph) 
@@ -533,6 +1067,15 @@ void freeGraph(Graph *graph)
    }
    if(graph->edges.holes.items) free(graph->edges.holes.items);
    if(graph->edges.items) free(graph->edges.items);
+   free(graph->summaries.marks);
+   free(graph->summaries.indegrees);
+   free(graph->summaries.outdegrees);
+   free(graph->summaries.signatures);
+   free(graph->summaries.lengths);
+   free(graph->summaries.roots);
+   freeEdgeMarkIndex(graph);
+   freeSortedAdjacency(graph);
+   freeAdjacencyBitmap(graph);
    if(graph->root_nodes != NULL) 
    {
       RootNodes *iterator = graph->root_nodes;
@@ -58,6 +58,69 @@ typedef struct EdgeArray {
    struct IntArray holes;
 } EdgeArray;
 
+/* The mark stored in the summary of a hole in the node array. */
+#define HOLE_MARK 255
+
+/* Neighbourhood signatures. Bit SIGNATURE_BIT(true, e, n) of a node's signature
+ * is set if the node has an outgoing edge with mark e whose target has mark n.
+ * SIGNATURE_BIT(false, e, n) is the same for incoming edges and their sources.
+ * Dashed nodes share the bits of grey nodes and grey edges share the bits of
+ * dashed edges, which only weakens the test. Generated matchers test the bits
+ * required by the marked edges of the LHS node with hasSignature. */
+#define SIGNATURE_MARK(mark) ((mark) == DASHED ? GREY : (mark))
+#define SIGNATURE_BIT(outgoing, edge_mark, node_mark) \
+   (1ULL << (((outgoing) ? 0 : 32) + SIGNATURE_MARK(edge_mark) * 5 + \
+             SIGNATURE_MARK(node_mark)))
+/* A signature is recomputed from the node's edges when it is next tested. */
+#define STALE_SIGNATURE (1ULL << 63)
+
+/* Packed copies of the node state tested first when a rule node is matched in
+ * isolation. The byte arrays are indexed like the node array so that they can
+ * be scanned many nodes at a time by filterNodes (see candidates.h).
+ * marks - The node's mark, or HOLE_MARK if the entry is a hole or has never
+ *         been used.
+ * indegrees, outdegrees - The node's degrees, saturated at 255.
+ * signatures - The node's neighbourhood signature, or STALE_SIGNATURE.
+ * lengths, roots - The node's label length, saturated at COUNTED_LENGTHS - 1,
+ *                  and root flag, as counted in the graph's element counts. */
+typedef struct NodeSummaries {
+   int capacity;
+   unsigned char *marks;
+   unsigned char *indegrees;
+   unsigned char *outdegrees;
+   unsigned long long *signatures;
+   unsigned char *lengths;
+   bool *roots;
+} NodeSummaries;
+
+/* The numbers of nodes and edges of a graph with each mark and each label
+ * length, and the number of root nodes. Labels of length COUNTED_LENGTHS - 1 or
+ * more share the last entry of the length arrays. The generated matching
+ * function of a rule compares them with the numbers of LHS items of each kind
+ * before searching. */
+typedef struct ElementCounts {
+   int node_marks[HOST_MARKS];
+   int edge_marks[HOST_MARKS];
+   int node_lengths[COUNTED_LENGTHS];
+   int edge_lengths[COUNTED_LENGTHS];
+   int root_nodes;
+} ElementCounts;
+
+/* Incremented by each change to a node class of any graph. The generated
+ * matching function of a rule records its value when the rule fails, and
+ * fails at once while none of the node classes the LHS can match have changed
+ * since (see classesChangedSince). */
+extern unsigned long change_epoch;
+
+/* The edges of a graph grouped by mark. edges[m] holds the indices of the
+ * edges with mark m in no particular order, and positions[i] is the position
+ * of edge i in the array of its mark, for the first capacity edges. */
+typedef struct EdgeMarkIndex {
+   IntArray edges[HOST_MARKS];
+   int capacity;
+   int *positions;
+} EdgeMarkIndex;
+
 /* ================================
  * Graph Data Structure + Functions
  * ================================ */
@@ -75,11 +138,65 @@ typedef struct Graph
     * In words, each of the first nodes.size items of the node array is either
     * a dummy node (a hole created by the removal of a node), or a valid node. */
    int number_of_nodes, number_of_edges;
+
+   /* Kept up to date by reportNodeChange, and by reportEdgeChange for the edge
+    * counts. */
+   NodeSummaries summaries;
+   ElementCounts counts;
+
+   /* class_epochs[c] is the value of change_epoch when a node of class c was
+    * last added, removed or changed, or when an edge incident to such a node
+    * was last added, removed or changed. Kept up to date by reportNodeChange
+    * and by the edge relabelling functions. */
+   unsigned long class_epochs[NODE_CLASSES];
+
+   /* Edges by mark, used to match an LHS edge before its endpoints. NULL until
+    * first used. */
+   EdgeMarkIndex *edge_mark_index;
+
+   /* Sorted view of the node's incident edges used by join matching. NULL
+    * until first used. See adjacency.h. */
+   struct SortedAdjacency *sorted_adjacency;
+
+   /* Bitmap of the ordered pairs of adjacent nodes. NULL until first used, or
+    * if the graph is too large. See adjacency.h. */
+   struct AdjacencyBitmap *adjacency_bitmap;
    
    /* Root nodes referenced in a linked list for fast access. */
    struct RootNodes *root_nodes;
 } Graph;
 
+/* If not NULL, this function is called with the index of each node added to or
+ * removed from a graph, and of each node whose label, root status or degree is
+ * changed, including changes made when undoing graph changes. Set by the match
+ * store module when incremental matching is used. */
+extern void (*node_change_hook)(Graph *graph, int index);
+
+/* Called by the functions below and by undoChanges with the index of each node
+ * added, removed or changed. Updates the node's summary, discards its sorted
+ * adjacency view and calls node_change_hook. Code that modifies the node array
+ * directly must call this function for each node it modifies. */
+void reportNodeChange(Graph *graph, int index);
+
+/* Called by the functions below and by undoChanges after the edge with the
+ * given index, endpoints and label is added to the graph (added set) or removed
+ * from it. Updates the element counts, the edge mark index and the adjacency
+ * bitmap. */
+void reportEdgeChange(Graph *graph, int index, int source, int target,
+                      HostLabel label, bool added);
+
+/* Returns the array of the indices of the graph's edges with the given mark,
+ * which must not be ANY. The index is built by the first call on a graph. The
+ * array remains valid until the graph is changed. */
+IntArray *getMarkedEdges(Graph *graph, MarkType mark);
+
+/* Returns true if, for some bit c set in classes, node class c of the graph
+ * has changed since change_epoch had the value epoch. */
+bool classesChangedSince(Graph *graph, unsigned int classes, unsigned long epoch);
+
+/* Returns true if each bit of required is set in the signature of the node. */
+bool hasSignature(Graph *graph, int index, unsigned long long required);
+
 /* The arguments nodes and edges are the initial sizes of the node array and the
  * edge array respectively. */
 Graph *newGraph(int nodes, int edges);
@@ -156,7 +273,29 @@ HostLabel getEdgeLabel(Graph *graph, int index);
 int getIndegree(Graph *graph, int index);
 int getOutdegree(Graph *graph, int index);
 
+/* The number of threads that format a large graph in printGraph. 0, the
+ * default, uses one thread per online processor. */
+extern int print_threads;
+
+/* Prints the graph in the host graph format, formatting large graphs in chunks
+ * on several threads. The output does not depend on the number of threads. */
 void printGraph(Graph *graph, FILE *file);
 void freeGraph(Graph *graph);
 
+/* ========================
+ * Locality-Seeded Matching
+ * ======================== */
+/* Used when the compiler flag -l is set. Rule application functions record the
+ * host indices of the nodes preserved or added by the rule. The matching
+ * functions of rules called in loops first try to match their first LHS node to
+ * one of these nodes or one of their neighbours before searching the whole host
+ * graph. Only the first MAX_TOUCHED_NODES nodes of an application are kept. */
+#define MAX_TOUCHED_NODES 64
+
+extern int touched_nodes[MAX_TOUCHED_NODES];
+extern int touched_node_count;
+
+void resetTouchedNodes(void);
+void addTouchedNode(int index);
+
 #endif /* INC_GRAPH_H */
@@ -14,6 +14,8 @@
   along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "graphStacks.h"
+#include <pthread.h>
+#include <stdint.h>
 
 typedef struct GraphChangeStack {
    int size;
@@ -218,6 +220,7 @@ void undoChanges(Graph *graph, int restore_point)
 
               graph->nodes.items[index] = dummy_node;
               graph->number_of_nodes--;
+              reportNodeChange(graph, index);
               break;
          }
 
@@ -237,14 +240,19 @@ void undoChanges(Graph *graph, int restore_point)
               else if(target->second_in_edge == index) target->second_in_edge = -1;
               else removeFromIntArray(&(target->in_edges), index);
               target->indegree--;
-              removeHostList(edge->label.list);
+              HostLabel label = edge->label;
+              removeHostList(label.list);
 
               if(change.added_edge.hole_filled)
                  graph->edges.holes.items[graph->edges.holes.size++] = index;
               else graph->edges.size--;
 
+              int source_index = edge->source, target_index = edge->target;
               graph->edges.items[index] = dummy_edge;
               graph->number_of_edges--;
+              reportEdgeChange(graph, index, source_index, target_index, label, false);
+              reportNodeChange(graph, source_index);
+              reportNodeChange(graph, target_index);
               break;
          }
          case REMOVED_NODE:
@@ -274,6 +282,7 @@ void undoChanges(Graph *graph, int restore_point)
               else graph->nodes.size++;
               if(node.root) addRootNode(graph, change.removed_node.index);
               graph->number_of_nodes++;
+              reportNodeChange(graph, change.removed_node.index);
               break;
          }
          case REMOVED_EDGE:
@@ -309,6 +318,10 @@ void undoChanges(Graph *graph, int restore_point)
               }
               else graph->edges.size++;
               graph->number_of_edges++;
+              reportEdgeChange(graph, edge.index, edge.source, edge.target, edge.label,
+                               true);
+              reportNodeChange(graph, edge.source);
+              reportNodeChange(graph, edge.target);
               break;
          }
          case RELABELLED_NODE:
@@ -395,69 +408,105 @@ void freeGraphChangeStack(void)
 Graph **graph_stack = NULL;
 int graph_stack_index = 0;
 int graph_copy_count = 0;
-
-void copyGraph(Graph *graph)
-{ 
-   printf("Copying host graph.\n");
-   if(graph_stack_index == GRAPH_STACK_SIZE)
-   {
-      print_to_log("Error: copyGraph called with a full graph stack.\n");
-      return;
-   }
-   if(graph_stack == NULL) graph_stack = calloc(GRAPH_STACK_SIZE, sizeof(Graph*));
-   if(graph_stack == NULL)
+int copy_threads = 0;
+
+/* Graphs with fewer nodes and edges than this are copied on the calling thread. */
+#define PARALLEL_COPY_THRESHOLD 65536
+
+/* The number of references to each host list made by the labels copied by a
+ * worker, in an open-addressing table keyed by the list pointer. The reference
+ * counts in the list store are updated once per list after the workers finish. */
+typedef struct ReferenceTable {
+   int capacity, size;
+   HostList **lists;
+   int *counts;
+} ReferenceTable;
+
+/* Worker number copies the entries of the node and edge arrays in its share of
+ * each array. The root nodes of its share are collected in the list from
+ * roots to last_root, highest index first. */
+typedef struct CopyWorker {
+   Graph *graph, *copy;
+   int number, workers;
+   RootNodes *roots, *last_root;
+   ReferenceTable references;
+} CopyWorker;
+
+#ifdef LIST_HASHING
+static void makeReferenceTable(ReferenceTable *table, int capacity)
+{
+   table->capacity = capacity;
+   table->size = 0;
+   table->lists = calloc(capacity, sizeof(HostList *));
+   table->counts = calloc(capacity, sizeof(int));
+   if(table->lists == NULL || table->counts == NULL)
    {
       print_to_log("Error (copyGraph): malloc failure.\n");
       exit(1);
    }
-   Graph *graph_copy = newGraph(graph->nodes.capacity, graph->edges.capacity); 
-
-   graph_copy->nodes.size = graph->nodes.size;
-   graph_copy->nodes.capacity = graph->nodes.capacity;
-   memcpy(graph_copy->nodes.items, graph->nodes.items, graph->nodes.capacity * sizeof(Node));
+}
 
-   graph_copy->edges.size = graph->edges.size;
-   graph_copy->edges.capacity = graph->edges.capacity;
-   memcpy(graph_copy->edges.items, graph->edges.items, graph->edges.capacity * sizeof(Edge));
+static void addReferences(ReferenceTable *table, HostList *list, int count)
+{
+   if(list == NULL) return;
+   if(2 * (table->size + 1) > table->capacity)
+   {
+      ReferenceTable old_table = *table;
+      makeReferenceTable(table, 2 * old_table.capacity);
+      int index;
+      for(index = 0; index < old_table.capacity; index++)
+         if(old_table.lists[index] != NULL)
+            addReferences(table, old_table.lists[index], old_table.counts[index]);
+      free(old_table.lists);
+      free(old_table.counts);
+   }
+   int index = (int)(((uintptr_t)list >> 4) * 2654435761u) & (table->capacity - 1);
+   while(table->lists[index] != NULL && table->lists[index] != list)
+      index = (index + 1) & (table->capacity - 1);
+   if(table->lists[index] == NULL)
+   {
+      table->lists[index] = list;
+      table->size++;
+   }
+   table->counts[index] += count;
+}
+#endif
 
-   /* newGraph allocates an initial holes array of size 16. This may be smaller
-    * then the holes array in the original graph. */
-   if(graph_copy->nodes.holes.capacity < graph->nodes.holes.capacity)
+static void copyEdgeArray(IntArray *copy, IntArray *array)
+{
+   copy->items = calloc(copy->size, sizeof(int));
+   if(copy->items == NULL)
    {
-      free(graph_copy->nodes.holes.items);
-      graph_copy->nodes.holes.items = calloc(graph->nodes.holes.capacity, sizeof(int));
-      if(graph_copy->nodes.holes.items == NULL)
-      {
-         print_to_log("Error (copyGraph): malloc failure.\n");
-         exit(1);
-      }
+      print_to_log("Error: (copyGraph): malloc failure.\n");
+      exit(1);
    }
-   graph_copy->nodes.holes.size = graph->nodes.holes.size;
-   graph_copy->nodes.holes.capacity = graph->nodes.holes.capacity;
-   memcpy(graph_copy->nodes.holes.items, graph->nodes.holes.items,
-          graph->nodes.holes.capacity * sizeof(int));
+   memcpy(copy->items, array->items, copy->size * sizeof(int));
+}
 
-   if(graph_copy->edges.holes.capacity < graph->edges.holes.capacity)
+static void *copyShare(void *argument)
+{
+   CopyWorker *worker = argument;
+   Graph *graph = worker->graph, *graph_copy = worker->copy;
+   int start = (int)((long long)graph->nodes.capacity * worker->number / worker->workers);
+   int end = (int)((long long)graph->nodes.capacity * (worker->number + 1) / worker->workers);
+   memcpy(graph_copy->nodes.items + start, graph->nodes.items + start,
+          (end - start) * sizeof(Node));
+
+   /* The summaries of the original graph are up to date, so they are copied
+    * rather than rebuilt. */
+   int index, size = end < graph->nodes.size ? end : graph->nodes.size;
+   if(start < size)
    {
-      free(graph_copy->edges.holes.items);
-      graph_copy->edges.holes.items = calloc(graph->edges.holes.capacity, sizeof(int));
-      if(graph_copy->edges.holes.items == NULL)
-      {
-         print_to_log("Error (copyGraph): malloc failure.\n");
-         exit(1);
-      }
+      NodeSummaries *summaries = &(graph->summaries), *copy = &(graph_copy->summaries);
+      memcpy(copy->marks + start, summaries->marks + start, size - start);
+      memcpy(copy->indegrees + start, summaries->indegrees + start, size - start);
+      memcpy(copy->outdegrees + start, summaries->outdegrees + start, size - start);
+      memcpy(copy->signatures + start, summaries->signatures + start,
+             (size - start) * sizeof(unsigned long long));
+      memcpy(copy->lengths + start, summaries->lengths + start, size - start);
+      memcpy(copy->roots + start, summaries->roots + start, (size - start) * sizeof(bool));
    }
-   graph_copy->edges.holes.size = graph->edges.holes.size;
-   graph_copy->edges.holes.capacity = graph->edges.holes.capacity;
-   memcpy(graph_copy->edges.holes.items, graph->edges.holes.items,
-          graph->edges.holes.capacity * sizeof(int));
-   
-   graph_copy->number_of_nodes = graph->number_of_nodes;
-   graph_copy->number_of_edges = graph->number_of_edges;
-   graph_copy->root_nodes = NULL;
- 
-   int index;
-   for(index = 0; index < graph_copy->nodes.size; index++)
+   for(index = start; index < size; index++)
    {
       Node *node_copy = getNode(graph_copy, index);
       /* The entry in the node array may be a dummy node, in which case nothing
@@ -466,57 +515,162 @@ void copyGraph(Graph *graph)
       {
          Node *node = getNode(graph, index);
          /* If necessary, copy the edges arrays of the original node. */
-         if(node->out_edges.items != NULL)
+         if(node->out_edges.items != NULL) copyEdgeArray(&(node_copy->out_edges), &(node->out_edges));
+         if(node->in_edges.items != NULL) copyEdgeArray(&(node_copy->in_edges), &(node->in_edges));
+         if(node_copy->root)
          {
-            node_copy->out_edges.items = calloc(node_copy->out_edges.size, sizeof(int));
-            if(node_copy->out_edges.items == NULL)
+            RootNodes *root_node = malloc(sizeof(RootNodes));
+            if(root_node == NULL)
             {
-               print_to_log("Error: (copyGraph): malloc failure.\n");
+               print_to_log("Error (copyGraph): malloc failure.\n");
                exit(1);
             }
-            memcpy(node_copy->out_edges.items, node->out_edges.items,
-                   node_copy->out_edges.size * sizeof(int));
+            root_node->index = index;
+            root_node->next = worker->roots;
+            if(worker->roots == NULL) worker->last_root = root_node;
+            worker->roots = root_node;
          }
-         if(node->in_edges.items != NULL)
-         {
-            node_copy->in_edges.items = calloc(node_copy->in_edges.size, sizeof(int));
-            if(node_copy->in_edges.items == NULL)
-            {
-               print_to_log("Error: (copyGraph): malloc failure.\n");
-               exit(1);
-            }
-            memcpy(node_copy->in_edges.items, node->in_edges.items,
-                   node_copy->in_edges.size * sizeof(int));
-         }
-         /* Populate the root nodes list. */
-         if(node_copy->root) addRootNode(graph_copy, node_copy->index);
          #ifdef LIST_HASHING
-            addHostList(node->label.list);
+            addReferences(&(worker->references), node->label.list, 1);
          #else
             node_copy->label.list = copyHostList(node->label.list);
          #endif
       }
    }
-   for(index = 0; index < graph_copy->edges.size; index++)
+
+   start = (int)((long long)graph->edges.capacity * worker->number / worker->workers);
+   end = (int)((long long)graph->edges.capacity * (worker->number + 1) / worker->workers);
+   memcpy(graph_copy->edges.items + start, graph->edges.items + start,
+          (end - start) * sizeof(Edge));
+   size = end < graph->edges.size ? end : graph->edges.size;
+   for(index = start; index < size; index++)
    {
       Edge *edge_copy = getEdge(graph_copy, index);
       if(edge_copy->index >= 0)
       {
          HostLabel label = getEdgeLabel(graph, index);
          #ifdef LIST_HASHING
-            addHostList(label.list);
+            addReferences(&(worker->references), label.list, 1);
          #else
             edge_copy->label.list = copyHostList(label.list);
          #endif
       }
    }
+   return NULL;
+}
+
+static void copyHoles(IntArray *copy, IntArray *holes)
+{
+   /* newGraph allocates an initial holes array of size 16. This may be smaller
+    * then the holes array in the original graph. */
+   if(copy->capacity < holes->capacity)
+   {
+      free(copy->items);
+      copy->items = calloc(holes->capacity, sizeof(int));
+      if(copy->items == NULL)
+      {
+         print_to_log("Error (copyGraph): malloc failure.\n");
+         exit(1);
+      }
+   }
+   copy->size = holes->size;
+   copy->capacity = holes->capacity;
+   memcpy(copy->items, holes->items, holes->capacity * sizeof(int));
+}
+
+void copyGraph(Graph *graph)
+{ 
+   if(graph_stack_index == GRAPH_STACK_SIZE)
+   {
+      print_to_log("Error: copyGraph called with a full graph stack.\n");
+      return;
+   }
+   if(graph_stack == NULL) graph_stack = calloc(GRAPH_STACK_SIZE, sizeof(Graph*));
+   if(graph_stack == NULL)
+   {
+      print_to_log("Error (copyGraph): malloc failure.\n");
+      exit(1);
+   }
+   Graph *graph_copy = newGraph(graph->nodes.capacity, graph->edges.capacity); 
+   graph_copy->nodes.size = graph->nodes.size;
+   graph_copy->edges.size = graph->edges.size;
+   copyHoles(&(graph_copy->nodes.holes), &(graph->nodes.holes));
+   copyHoles(&(graph_copy->edges.holes), &(graph->edges.holes));
+   graph_copy->number_of_nodes = graph->number_of_nodes;
+   graph_copy->number_of_edges = graph->number_of_edges;
+   graph_copy->counts = graph->counts;
+   memcpy(graph_copy->class_epochs, graph->class_epochs, sizeof(graph->class_epochs));
+
+   /* The node and edge arrays are divided among the workers, which copy the
+    * entries, the edge arrays of the nodes and the labels of their shares. */
+   int workers = 1;
+   if(graph->nodes.size + graph->edges.size >= PARALLEL_COPY_THRESHOLD)
+   {
+      workers = copy_threads;
+      if(workers < 1) workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+      if(workers < 1) workers = 1;
+   }
+   CopyWorker copy_workers[workers];
+   pthread_t handles[workers];
+   bool started[workers];
+   int number;
+   for(number = 0; number < workers; number++)
+   {
+      CopyWorker *worker = &copy_workers[number];
+      worker->graph = graph;
+      worker->copy = graph_copy;
+      worker->number = number;
+      worker->workers = workers;
+      worker->roots = NULL;
+      worker->last_root = NULL;
+      #ifdef LIST_HASHING
+         makeReferenceTable(&(worker->references), 1024);
+      #endif
+   }
+   for(number = 1; number < workers; number++)
+      started[number] = pthread_create(&handles[number], NULL, copyShare,
+                                       &copy_workers[number]) == 0;
+   copyShare(&copy_workers[0]);
+   for(number = 1; number < workers; number++)
+   {
+      if(started[number]) pthread_join(handles[number], NULL);
+      else copyShare(&copy_workers[number]);
+   }
+
+   /* The root node list holds the root nodes from the highest index to the
+    * lowest, as if each had been added with addRootNode in index order. The
+    * references are added to the list store on this thread, which owns it. */
+   graph_copy->root_nodes = NULL;
+   for(number = 0; number < workers; number++)
+   {
+      CopyWorker *worker = &copy_workers[number];
+      if(worker->roots != NULL)
+      {
+         worker->last_root->next = graph_copy->root_nodes;
+         graph_copy->root_nodes = worker->roots;
+      }
+      #ifdef LIST_HASHING
+         int index;
+         for(index = 0; index < worker->references.capacity; index++)
+            if(worker->references.lists[index] != NULL)
+               addHostListReferences(worker->references.lists[index],
+                                     worker->references.counts[index]);
+         free(worker->references.lists);
+         free(worker->references.counts);
+      #endif
+   }
+   if(node_change_hook != NULL)
+   {
+      int index;
+      for(index = 0; index < graph_copy->nodes.size; index++)
+         node_change_hook(graph_copy, index);
+   }
    graph_stack[graph_stack_index++] = graph_copy;
    graph_copy_count++;
 }
 
 Graph *revertGraph(Graph *current_graph, int restore_point)
 {
-   printf("Popping copy of host graph.\n");
    if(graph_stack == NULL) return NULL;
    assert(graph_stack_index >= restore_point);
    if(graph_stack_index == restore_point) return current_graph;
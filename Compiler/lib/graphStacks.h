@@ -112,7 +112,13 @@ extern Graph **graph_stack;
 extern int graph_stack_index;
 extern int graph_copy_count;
 
-/* Creates a memory copy of the passed graph and pushes it to the graph stack. */
+/* The number of threads that copy a large graph in copyGraph. 0, the default,
+ * uses one thread per online processor. */
+extern int copy_threads;
+
+/* Creates a memory copy of the passed graph and pushes it to the graph stack.
+ * The node and edge arrays of large graphs are copied on several threads, and
+ * the reference counts of the labels' lists are updated once per list. */
 void copyGraph(Graph *graph);
 
 /* Returns the graph at the stack entry <restore_point> entries from the
@@ -0,0 +1,715 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "hostParser.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/mman.h>
+
+int parse_threads = 0;
+
+/* The number of entries of node_map. */
+static int node_map_size = 0;
+
+/* A file is only divided into chunks of at least this many bytes. */
+#define PARSE_CHUNK_SIZE (1 << 20)
+
+typedef struct ParsedNode {
+   int id;
+   bool root;
+   HostLabel label;
+} ParsedNode;
+
+typedef struct ParsedEdge {
+   int id, source, target;
+   HostLabel label;
+} ParsedEdge;
+
+/* A chunk is parsed from its position to its end. Its last item may continue
+ * to limit, the end of the file, which is only reached by the last chunk of a
+ * valid file.
+ * first_item, bar and close point to the chunk's first node or edge, the '|'
+ * before the edges and the closing ']', or are NULL if the chunk does not
+ * contain them. A valid chunk contains nodes, edges, or nodes followed by the
+ * bar and edges.
+ * If the chunk is invalid, error points to its first error, described by
+ * message.
+ * atoms and strings hold the label being parsed. The atoms' strings are kept
+ * as offsets into strings until the label is complete, since the buffer moves
+ * when it grows. */
+typedef struct Chunk {
+   const char *position, *end, *limit;
+   ParsedNode *nodes;
+   int node_count, node_capacity;
+   ParsedEdge *edges;
+   int edge_count, edge_capacity;
+   const char *first_item, *bar, *close;
+   const char *error;
+   char message[96];
+   HostAtom *atoms;
+   int atom_capacity;
+   char *strings;
+   size_t strings_size, strings_capacity;
+} Chunk;
+
+static void *allocate(void *pointer, size_t size)
+{
+   pointer = realloc(pointer, size);
+   if(pointer == NULL)
+   {
+      print_to_log("Error (parseHostGraph): malloc failure.\n");
+      exit(1);
+   }
+   return pointer;
+}
+
+static bool fail(Chunk *chunk, const char *format, ...)
+{
+   if(chunk->error != NULL) return false;
+   chunk->error = chunk->position;
+   va_list arguments;
+   va_start(arguments, format);
+   vsnprintf(chunk->message, sizeof(chunk->message), format, arguments);
+   va_end(arguments);
+   return false;
+}
+
+static const char *skipLayout(const char *position, const char *limit)
+{
+   while(position < limit)
+   {
+      char character = *position;
+      if(character == ' ' || character == '\t' || character == '\r' || character == '\n')
+         position++;
+      else if(character == '/' && position + 1 < limit && position[1] == '/')
+      {
+         const char *newline = memchr(position, '\n', limit - position);
+         position = newline == NULL ? limit : newline + 1;
+      }
+      else break;
+   }
+   return position;
+}
+
+/* Returns the next character after layout, or 0 at the end of the file. */
+static char peek(Chunk *chunk)
+{
+   chunk->position = skipLayout(chunk->position, chunk->limit);
+   return chunk->position < chunk->limit ? *chunk->position : 0;
+}
+
+static bool unexpected(Chunk *chunk, const char *expected)
+{
+   if(chunk->position >= chunk->limit)
+      return fail(chunk, "unexpected end of file, expecting %s", expected);
+   return fail(chunk, "unexpected '%c', expecting %s", *chunk->position, expected);
+}
+
+static bool expect(Chunk *chunk, char symbol)
+{
+   if(peek(chunk) == symbol)
+   {
+      chunk->position++;
+      return true;
+   }
+   char expected[4] = {'\'', symbol, '\'', '\0'};
+   return unexpected(chunk, expected);
+}
+
+static bool isDigit(char character)
+{
+   return character >= '0' && character <= '9';
+}
+
+static bool isWordCharacter(char character)
+{
+   return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+          isDigit(character) || character == '_';
+}
+
+/* Returns true if the next word after layout is the given keyword, which is
+ * then skipped. */
+static bool skipKeyword(Chunk *chunk, const char *keyword)
+{
+   peek(chunk);
+   size_t length = strlen(keyword);
+   const char *position = chunk->position;
+   if((size_t)(chunk->limit - position) < length || memcmp(position, keyword, length) != 0)
+      return false;
+   if(position + length < chunk->limit && isWordCharacter(position[length])) return false;
+   chunk->position += length;
+   return true;
+}
+
+static bool parseNumber(Chunk *chunk, int *number)
+{
+   if(!isDigit(peek(chunk))) return unexpected(chunk, "a number");
+   long value = 0;
+   const char *position = chunk->position;
+   while(position < chunk->limit && isDigit(*position))
+   {
+      value = value * 10 + (*position++ - '0');
+      if(value > INT_MAX) return fail(chunk, "number out of range");
+   }
+   chunk->position = position;
+   *number = (int)value;
+   return true;
+}
+
+/* Skips a coordinate of a position: a possibly signed integer or decimal,
+ * with an optional exponent. */
+static bool skipCoordinate(Chunk *chunk)
+{
+   char character = peek(chunk);
+   if(character == '-' || character == '+')
+   {
+      chunk->position++;
+      peek(chunk);
+   }
+   const char *position = chunk->position, *limit = chunk->limit;
+   bool digits = false;
+   while(position < limit && isDigit(*position))
+   {
+      position++;
+      digits = true;
+   }
+   if(position < limit && *position == '.')
+   {
+      position++;
+      digits = false;
+      while(position < limit && isDigit(*position))
+      {
+         position++;
+         digits = true;
+      }
+   }
+   if(!digits) return unexpected(chunk, "a number");
+   if(position < limit && (*position == 'e' || *position == 'E'))
+   {
+      const char *exponent = position + 1;
+      if(exponent < limit && (*exponent == '-' || *exponent == '+')) exponent++;
+      if(exponent < limit && isDigit(*exponent))
+      {
+         while(exponent < limit && isDigit(*exponent)) exponent++;
+         position = exponent;
+      }
+   }
+   chunk->position = position;
+   return true;
+}
+
+static bool skipPosition(Chunk *chunk)
+{
+   return expect(chunk, '<') && skipCoordinate(chunk) && expect(chunk, ',') &&
+          skipCoordinate(chunk) && expect(chunk, '>');
+}
+
+static void addAtom(Chunk *chunk, int *length, HostAtom atom)
+{
+   if(*length == chunk->atom_capacity)
+   {
+      chunk->atom_capacity = chunk->atom_capacity == 0 ? 64 : 2 * chunk->atom_capacity;
+      chunk->atoms = allocate(chunk->atoms, chunk->atom_capacity * sizeof(HostAtom));
+   }
+   chunk->atoms[(*length)++] = atom;
+}
+
+/* Copies the string at the current position to the string buffer and adds it
+ * to the label's atoms. */
+static bool parseString(Chunk *chunk, int *length)
+{
+   const char *start = chunk->position + 1, *position = start;
+   while(position < chunk->limit && *position != '"')
+   {
+      char character = *position;
+      if(!isWordCharacter(character) && character != ' ')
+      {
+         chunk->position = position;
+         if(character == '\n') return fail(chunk, "string continues on new line");
+         return fail(chunk, "invalid character '%c' in string", character);
+      }
+      position++;
+   }
+   if(position == chunk->limit) return fail(chunk, "unterminated string");
+   size_t size = position - start;
+   if(chunk->strings_size + size + 1 > chunk->strings_capacity)
+   {
+      while(chunk->strings_size + size + 1 > chunk->strings_capacity)
+         chunk->strings_capacity = chunk->strings_capacity == 0 ? 256 : 2 * chunk->strings_capacity;
+      chunk->strings = allocate(chunk->strings, chunk->strings_capacity);
+   }
+   memcpy(chunk->strings + chunk->strings_size, start, size);
+   chunk->strings[chunk->strings_size + size] = '\0';
+   HostAtom atom;
+   atom.type = 's';
+   atom.str = (string)(uintptr_t)chunk->strings_size;
+   addAtom(chunk, length, atom);
+   chunk->strings_size += size + 1;
+   chunk->position = position + 1;
+   return true;
+}
+
+/* Parses a label. If first is not NULL, it points to the label's first atom,
+ * an integer that has already been parsed. */
+static bool parseLabel(Chunk *chunk, HostLabel *label, const int *first)
+{
+   int length = 0, index;
+   chunk->strings_size = 0;
+   HostAtom atom;
+   bool more = true;
+   if(first != NULL)
+   {
+      atom.type = 'i';
+      atom.num = *first;
+      addAtom(chunk, &length, atom);
+      more = peek(chunk) == ':';
+      if(more) chunk->position++;
+   }
+   while(more)
+   {
+      char character = peek(chunk);
+      if(isDigit(character) || character == '-')
+      {
+         if(character == '-') chunk->position++;
+         atom.type = 'i';
+         if(!parseNumber(chunk, &atom.num)) return false;
+         if(character == '-') atom.num = -atom.num;
+         addAtom(chunk, &length, atom);
+      }
+      else if(character == '"')
+      {
+         if(!parseString(chunk, &length)) return false;
+      }
+      else if(!skipKeyword(chunk, "empty")) return unexpected(chunk, "a list");
+      more = peek(chunk) == ':';
+      if(more) chunk->position++;
+   }
+
+   MarkType mark = NONE;
+   if(peek(chunk) == '#')
+   {
+      chunk->position++;
+      if(skipKeyword(chunk, "red")) mark = RED;
+      else if(skipKeyword(chunk, "green")) mark = GREEN;
+      else if(skipKeyword(chunk, "blue")) mark = BLUE;
+      else if(skipKeyword(chunk, "grey")) mark = GREY;
+      else if(skipKeyword(chunk, "dashed")) mark = DASHED;
+      else return unexpected(chunk, "a mark");
+   }
+   for(index = 0; index < length; index++)
+      if(chunk->atoms[index].type == 's')
+         chunk->atoms[index].str = chunk->strings + (uintptr_t)chunk->atoms[index].str;
+   if(length == 0) *label = mark == NONE ? blank_label : makeEmptyLabel(mark);
+   else *label = makeHostLabel(mark, length, makeHostList(chunk->atoms, length, false));
+   return true;
+}
+
+static void addParsedNode(Chunk *chunk, int id, bool root, HostLabel label)
+{
+   if(chunk->node_count == chunk->node_capacity)
+   {
+      chunk->node_capacity = chunk->node_capacity == 0 ? 1024 : 2 * chunk->node_capacity;
+      chunk->nodes = allocate(chunk->nodes, chunk->node_capacity * sizeof(ParsedNode));
+   }
+   ParsedNode *node = &(chunk->nodes[chunk->node_count++]);
+   node->id = id;
+   node->root = root;
+   node->label = label;
+}
+
+static void addParsedEdge(Chunk *chunk, int id, int source, int target, HostLabel label)
+{
+   if(chunk->edge_count == chunk->edge_capacity)
+   {
+      chunk->edge_capacity = chunk->edge_capacity == 0 ? 1024 : 2 * chunk->edge_capacity;
+      chunk->edges = allocate(chunk->edges, chunk->edge_capacity * sizeof(ParsedEdge));
+   }
+   ParsedEdge *edge = &(chunk->edges[chunk->edge_count++]);
+   edge->id = id;
+   edge->source = source;
+   edge->target = target;
+   edge->label = label;
+}
+
+/* Parses the node or edge at the current position. A node and an edge differ
+ * after the first comma: an edge continues with its source and a comma. */
+static bool parseItem(Chunk *chunk)
+{
+   const char *start = chunk->position;
+   if(chunk->first_item == NULL) chunk->first_item = start;
+   chunk->position++;
+   int id, number;
+   if(!parseNumber(chunk, &id)) return false;
+   bool root = false;
+   peek(chunk);
+   if(chunk->limit - chunk->position >= 3 && memcmp(chunk->position, "(R)", 3) == 0)
+   {
+      root = true;
+      chunk->position += 3;
+   }
+   if(!expect(chunk, ',')) return false;
+   bool starts_with_number = !root && isDigit(peek(chunk));
+   if(starts_with_number)
+   {
+      if(!parseNumber(chunk, &number)) return false;
+      if(peek(chunk) == ',')
+      {
+         chunk->position++;
+         int target;
+         HostLabel label;
+         if(!parseNumber(chunk, &target) || !expect(chunk, ',') ||
+            !parseLabel(chunk, &label, NULL)) return false;
+         if(!expect(chunk, ')'))
+         {
+            removeHostList(label.list);
+            return false;
+         }
+         if(chunk->node_count > 0 && chunk->bar == NULL)
+         {
+            chunk->position = start;
+            removeHostList(label.list);
+            return fail(chunk, "unexpected edge before '|'");
+         }
+         addParsedEdge(chunk, id, number, target, label);
+         return true;
+      }
+   }
+   HostLabel label;
+   if(!parseLabel(chunk, &label, starts_with_number ? &number : NULL)) return false;
+   if((peek(chunk) == '<' && !skipPosition(chunk)) || !expect(chunk, ')'))
+   {
+      removeHostList(label.list);
+      return false;
+   }
+   if(chunk->edge_count > 0 || chunk->bar != NULL)
+   {
+      chunk->position = start;
+      removeHostList(label.list);
+      return fail(chunk, "unexpected node after '|'");
+   }
+   addParsedNode(chunk, id, root, label);
+   return true;
+}
+
+static void *parseChunk(void *argument)
+{
+   Chunk *chunk = argument;
+   while(chunk->error == NULL)
+   {
+      char character = peek(chunk);
+      if(chunk->position >= chunk->end) break;
+      if(chunk->close != NULL) fail(chunk, "unexpected '%c' after ']'", character);
+      else if(character == '(') parseItem(chunk);
+      else if(character == '|')
+      {
+         if(chunk->bar != NULL || chunk->edge_count > 0) fail(chunk, "unexpected '|'");
+         chunk->bar = chunk->position++;
+      }
+      else if(character == ']') chunk->close = chunk->position++;
+      else unexpected(chunk, "'(', '|' or ']'");
+   }
+   /* Only an invalid file has an item that runs into the next chunk. */
+   if(chunk->error == NULL && chunk->position > chunk->end)
+   {
+      chunk->position = chunk->end;
+      fail(chunk, "unexpected '%c'", *chunk->end);
+   }
+   return NULL;
+}
+
+/* Returns true if position is the '(' that starts a node or an edge. */
+static bool startsItem(const char *position, const char *limit)
+{
+   if(*position != '(') return false;
+   position = skipLayout(position + 1, limit);
+   return position < limit && isDigit(*position);
+}
+
+/* Returns the start of the first node or edge after the first line break at or
+ * after position, or limit. A line starts outside comments and strings. */
+static const char *findItemStart(const char *position, const char *limit)
+{
+   const char *newline = memchr(position, '\n', limit - position);
+   if(newline == NULL) return limit;
+   position = newline + 1;
+   while(position < limit)
+   {
+      if(*position == '/' && position + 1 < limit && position[1] == '/')
+      {
+         newline = memchr(position, '\n', limit - position);
+         position = newline == NULL ? limit : newline + 1;
+      }
+      else if(*position == '"')
+      {
+         position++;
+         while(position < limit && *position != '"' && *position != '\n') position++;
+         if(position < limit) position++;
+      }
+      else if(startsItem(position, limit)) return position;
+      else position++;
+   }
+   return limit;
+}
+
+/* Maps regular files into memory and reads other streams. */
+static char *readText(FILE *file, size_t *length, bool *mapped)
+{
+   struct stat status;
+   int descriptor = fileno(file);
+   *mapped = false;
+   if(descriptor >= 0 && fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+      status.st_size > 0 && ftell(file) == 0)
+   {
+      char *text = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if(text != MAP_FAILED)
+      {
+         *mapped = true;
+         *length = status.st_size;
+         return text;
+      }
+   }
+   size_t size = 0, capacity = 65536, count;
+   char *text = allocate(NULL, capacity);
+   while((count = fread(text + size, 1, capacity - size, file)) > 0)
+   {
+      size += count;
+      if(size == capacity) text = allocate(text, capacity *= 2);
+   }
+   *length = size;
+   return text;
+}
+
+static void reportError(const char *text, const char *position, const char *message)
+{
+   int line = 1;
+   const char *newline;
+   while((newline = memchr(text, '\n', position - text)) != NULL)
+   {
+      line++;
+      text = newline + 1;
+   }
+   fprintf(stderr, "Error at line %d: %s.\n\n", line, message);
+}
+
+/* Checks that the chunks form the node list, the bar, the edge list and the
+ * closing bracket of a host graph. Returns false after reporting the first
+ * error otherwise. */
+static bool checkChunks(const char *text, Chunk *chunks, int count)
+{
+   bool after_bar = false;
+   int index;
+   for(index = 0; index < count; index++)
+   {
+      Chunk *chunk = &chunks[index];
+      if(chunk->error != NULL)
+      {
+         reportError(text, chunk->error, chunk->message);
+         return false;
+      }
+      if(after_bar && chunk->bar != NULL)
+      {
+         reportError(text, chunk->bar, "unexpected '|'");
+         return false;
+      }
+      if(after_bar && chunk->node_count > 0)
+      {
+         reportError(text, chunk->first_item, "unexpected node after '|'");
+         return false;
+      }
+      if(!after_bar && chunk->bar == NULL && chunk->edge_count > 0)
+      {
+         reportError(text, chunk->first_item, "unexpected edge before '|'");
+         return false;
+      }
+      if(chunk->bar != NULL) after_bar = true;
+      if(chunk->close != NULL && !after_bar)
+      {
+         reportError(text, chunk->close, "unexpected ']', expecting '|'");
+         return false;
+      }
+      /* A chunk stops at the start of the next, which follows the bracket. */
+      if(chunk->close != NULL && index < count - 1)
+      {
+         reportError(text, chunks[index + 1].first_item, "unexpected '(' after ']'");
+         return false;
+      }
+   }
+   if(chunks[count - 1].close == NULL)
+   {
+      reportError(text, chunks[count - 1].limit, "unexpected end of file, expecting ']'");
+      return false;
+   }
+   return true;
+}
+
+/* Checks that the edges refer to nodes of the file, using node_map to mark the
+ * IDs of the nodes. */
+static bool checkEdges(Chunk *chunks, int count)
+{
+   int index, item;
+   for(index = 0; index < count; index++)
+      for(item = 0; item < chunks[index].node_count; item++)
+         node_map[chunks[index].nodes[item].id] = 0;
+   for(index = 0; index < count; index++)
+   {
+      for(item = 0; item < chunks[index].edge_count; item++)
+      {
+         ParsedEdge *edge = &(chunks[index].edges[item]);
+         int end = edge->source >= node_map_size || node_map[edge->source] < 0 ?
+                   edge->source : edge->target;
+         if(end >= node_map_size || node_map[end] < 0)
+         {
+            fprintf(stderr, "Error: edge %d refers to undefined node %d.\n\n", edge->id, end);
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+Graph *parseHostGraph(FILE *file, int nodes, int edges)
+{
+   size_t length;
+   bool mapped;
+   char *text = readText(file, &length, &mapped);
+   const char *limit = text + length;
+   host = NULL;
+
+   /* The opening bracket and the position of the graph are parsed here, the
+    * rest of the file by the chunks. */
+   Chunk header;
+   memset(&header, 0, sizeof(Chunk));
+   header.position = text;
+   header.limit = limit;
+   if(!expect(&header, '[') ||
+      (peek(&header) == '<' && (!skipPosition(&header) || !expect(&header, '|'))))
+   {
+      reportError(text, header.error, header.message);
+      if(mapped) munmap(text, length);
+      else free(text);
+      return NULL;
+   }
+   const char *body = header.position;
+
+   int threads = parse_threads;
+   if(threads < 1) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+   if(threads < 1) threads = 1;
+   if((size_t)(limit - body) / PARSE_CHUNK_SIZE < (size_t)threads)
+      threads = (int)((limit - body) / PARSE_CHUNK_SIZE);
+   if(threads < 1) threads = 1;
+   #ifdef LIST_HASHING
+      /* Lists made on other threads would go to their own stores. */
+      if(list_store_mode == PER_THREAD_LIST_STORE) threads = 1;
+   #endif
+
+   /* Chunk boundaries that fall on the same item are merged. */
+   const char *starts[threads + 1];
+   int count = 1, index;
+   starts[0] = body;
+   for(index = 1; index < threads; index++)
+   {
+      const char *start = findItemStart(body + (limit - body) / threads * index, limit);
+      if(start > starts[count - 1] && start < limit) starts[count++] = start;
+   }
+   starts[count] = limit;
+   Chunk chunks[count];
+   for(index = 0; index < count; index++)
+   {
+      memset(&chunks[index], 0, sizeof(Chunk));
+      chunks[index].position = starts[index];
+      chunks[index].end = starts[index + 1];
+      chunks[index].limit = limit;
+   }
+
+   if(count == 1) parseChunk(&chunks[0]);
+   else
+   {
+      #ifdef LIST_HASHING
+         ListStoreMode mode = list_store_mode;
+         if(mode == SHARED_LIST_STORE) list_store_mode = CONCURRENT_LIST_STORE;
+      #endif
+      pthread_t handles[count];
+      bool started[count];
+      for(index = 1; index < count; index++)
+         started[index] = pthread_create(&handles[index], NULL, parseChunk, &chunks[index]) == 0;
+      parseChunk(&chunks[0]);
+      for(index = 1; index < count; index++)
+      {
+         if(started[index]) pthread_join(handles[index], NULL);
+         else parseChunk(&chunks[index]);
+      }
+      #ifdef LIST_HASHING
+         list_store_mode = mode;
+      #endif
+   }
+
+   int node_count = 0, edge_count = 0, max_id = -1, item;
+   for(index = 0; index < count; index++)
+   {
+      node_count += chunks[index].node_count;
+      edge_count += chunks[index].edge_count;
+      for(item = 0; item < chunks[index].node_count; item++)
+         if(chunks[index].nodes[item].id > max_id) max_id = chunks[index].nodes[item].id;
+   }
+   node_map_size = max_id + 1 > 0 ? max_id + 1 : 1;
+   node_map = allocate(NULL, node_map_size * sizeof(int));
+   for(item = 0; item < node_map_size; item++) node_map[item] = -1;
+
+   bool valid = checkChunks(text, chunks, count) && checkEdges(chunks, count);
+   if(valid)
+   {
+      /* The arrays are allocated once for the whole graph. */
+      host = newGraph(nodes > node_count ? nodes : node_count,
+                      edges > edge_count ? edges : edge_count);
+      for(index = 0; index < count; index++)
+      {
+         for(item = 0; item < chunks[index].node_count; item++)
+         {
+            ParsedNode *node = &(chunks[index].nodes[item]);
+            node_map[node->id] = addNode(host, node->root, node->label);
+         }
+      }
+      for(index = 0; index < count; index++)
+      {
+         for(item = 0; item < chunks[index].edge_count; item++)
+         {
+            ParsedEdge *edge = &(chunks[index].edges[item]);
+            addEdge(host, edge->label, node_map[edge->source], node_map[edge->target]);
+         }
+      }
+   }
+   for(index = 0; index < count; index++)
+   {
+      Chunk *chunk = &chunks[index];
+      if(!valid)
+      {
+         for(item = 0; item < chunk->node_count; item++)
+            removeHostList(chunk->nodes[item].label.list);
+         for(item = 0; item < chunk->edge_count; item++)
+            removeHostList(chunk->edges[item].label.list);
+      }
+      free(chunk->nodes);
+      free(chunk->edges);
+      free(chunk->atoms);
+      free(chunk->strings);
+   }
+   free(node_map);
+   node_map = NULL;
+   node_map_size = 0;
+   if(mapped) munmap(text, length);
+   else free(text);
+   return host;
+}
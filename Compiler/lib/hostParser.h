@@ -0,0 +1,77 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ======================
+  GP 2 Host Graph Parser
+  ======================
+
+  Builds the host graph from the textual description of a host graph:
+
+  HostGraph := '[' [Position '|'] {Node} '|' {Edge} ']'
+  Node      := '(' NUM ['(R)'] ',' Label [Position] ')'
+  Edge      := '(' NUM ',' NUM ',' NUM ',' Label ')'
+  Label     := List ['#' Mark]
+  List      := Atom {':' Atom}
+  Atom      := NUM | '-' NUM | String | 'empty'
+  Position  := '<' Number ',' Number '>'
+
+  where Mark is one of red, green, blue, grey and dashed, a string is a
+  sequence of letters, digits, underscores and spaces in double quotes, and
+  Number is a possibly signed integer or decimal. Positions are layout
+  information for the editor and are ignored. Whitespace and comments from
+  // to the end of the line may appear between any two symbols. Lists and
+  strings have no length limit.
+
+  The file is mapped into memory. A large file is divided into chunks, which
+  are parsed on separate threads: each chunk starts at the first node or
+  edge after a line break, since a line break never occurs inside a comment
+  or string. The lists of the labels are added to the list store as they are
+  parsed, in the concurrent mode of the store (see label.h). The nodes and
+  edges of the chunks are then added to the graph in the order of the file.
+
+  =============
+  Update Policy
+  =============
+  Changes to the GP 2 syntax as defined in this file must be mirrored in the
+  host graph parser of the graphical editor.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_HOST_PARSER_H
+#define INC_HOST_PARSER_H
+
+#include "globals.h"
+#include "graph.h"
+#include "label.h"
+
+extern struct Graph *host;
+/* Maps the IDs of the nodes in the host graph file to their indices in the
+ * graph while the file is parsed. */
+extern int *node_map;
+
+/* The number of threads that parse a large host graph file. 0, the default,
+ * uses one thread per online processor. */
+extern int parse_threads;
+
+/* Parses the host graph in the file into a new graph with initial node and edge
+ * arrays of at least the given sizes, which is assigned to host and returned.
+ * Returns NULL, after printing the error to stderr, if the file does not
+ * contain a valid host graph. The parser can be called on any number of files
+ * in turn. */
+struct Graph *parseHostGraph(FILE *file, int nodes, int edges);
+
+#endif /* INC_HOST_PARSER_H */
@@ -14,11 +14,136 @@
   along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
 
 #include "label.h"
+#include <pthread.h>
 
 HostLabel blank_label = {NONE, 0, NULL};
 
 #ifdef LIST_HASHING
 Bucket **list_store = NULL;
+ListStoreMode list_store_mode = SHARED_LIST_STORE;
+
+/* The store of the calling thread in PER_THREAD_LIST_STORE mode. */
+static __thread Bucket **thread_list_store = NULL;
+/* Held while the shared store is allocated. */
+static pthread_mutex_t list_store_init_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* The chains of the hash table are divided among the shard locks by their hash,
+ * so the functions that change the store only exclude each other when their
+ * lists hash to the same shard. Each lock has a cache line of its own. */
+#define LIST_STORE_SHARDS 64
+typedef struct ShardLock {
+   pthread_mutex_t lock;
+} __attribute__((aligned(64))) ShardLock;
+static ShardLock shard_locks[LIST_STORE_SHARDS] =
+   {[0 ... LIST_STORE_SHARDS - 1] = {PTHREAD_MUTEX_INITIALIZER}};
+
+/* The lock counters are kept per thread, so that counting does not make the
+ * threads share a cache line again. The counters of the live threads are in
+ * the list from live_counters; those of threads that have exited are added to
+ * the retired totals by the destructor of counters_key. */
+typedef struct LockCounters {
+   unsigned long acquisitions, contended;
+   struct LockCounters *prev, *next;
+} __attribute__((aligned(64))) LockCounters;
+static __thread LockCounters *thread_counters = NULL;
+static LockCounters *live_counters = NULL;
+static unsigned long retired_acquisitions = 0, retired_contended = 0;
+static pthread_mutex_t counters_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t counters_key;
+static pthread_once_t counters_key_once = PTHREAD_ONCE_INIT;
+
+static void retireCounters(void *argument)
+{
+   LockCounters *counters = argument;
+   pthread_mutex_lock(&counters_lock);
+   retired_acquisitions += counters->acquisitions;
+   retired_contended += counters->contended;
+   if(counters->prev == NULL) live_counters = counters->next;
+   else counters->prev->next = counters->next;
+   if(counters->next != NULL) counters->next->prev = counters->prev;
+   pthread_mutex_unlock(&counters_lock);
+   free(counters);
+}
+
+static void makeCountersKey(void)
+{
+   pthread_key_create(&counters_key, retireCounters);
+}
+
+static LockCounters *getLockCounters(void)
+{
+   if(thread_counters != NULL) return thread_counters;
+   pthread_once(&counters_key_once, makeCountersKey);
+   LockCounters *counters = NULL;
+   if(posix_memalign((void **)&counters, 64, sizeof(LockCounters)) != 0)
+   {
+      print_to_log("Error (lockShard): malloc failure.\n");
+      exit(1);
+   }
+   counters->acquisitions = 0;
+   counters->contended = 0;
+   counters->prev = NULL;
+   pthread_mutex_lock(&counters_lock);
+   counters->next = live_counters;
+   if(live_counters != NULL) live_counters->prev = counters;
+   live_counters = counters;
+   pthread_mutex_unlock(&counters_lock);
+   pthread_setspecific(counters_key, counters);
+   thread_counters = counters;
+   return counters;
+}
+
+static bool lockingListStore(void)
+{
+   if(list_store_mode == CONCURRENT_LIST_STORE) return true;
+   return list_store_mode == SHARED_LIST_STORE && concurrent_matching;
+}
+
+/* A shard that cannot be taken at once counts as contended. The counters are
+ * only written by their thread; the relaxed stores keep them readable by
+ * printListStoreCounters. */
+static void lockShard(int hash)
+{
+   pthread_mutex_t *lock = &shard_locks[hash % LIST_STORE_SHARDS].lock;
+   LockCounters *counters = getLockCounters();
+   __atomic_store_n(&counters->acquisitions, counters->acquisitions + 1, __ATOMIC_RELAXED);
+   if(pthread_mutex_trylock(lock) == 0) return;
+   __atomic_store_n(&counters->contended, counters->contended + 1, __ATOMIC_RELAXED);
+   pthread_mutex_lock(lock);
+}
+
+#define LOCK_LIST_STORE(hash) \
+   do { if(lockingListStore()) lockShard(hash); } while(0)
+#define UNLOCK_LIST_STORE(hash) \
+   do { if(lockingListStore()) \
+           pthread_mutex_unlock(&shard_locks[(hash) % LIST_STORE_SHARDS].lock); } while(0)
+
+static Bucket **makeListStore(void)
+{
+   Bucket **store = calloc(LIST_TABLE_SIZE, sizeof(Bucket*));
+   if(store == NULL)
+   {
+      print_to_log("Error(addListToStore): malloc failure.\n");
+      exit(1);
+   }
+   return store;
+}
+
+/* Returns the store of the current mode, allocating it on first use. */
+static Bucket **getListStore(void)
+{
+   if(list_store_mode == PER_THREAD_LIST_STORE)
+   {
+      if(thread_list_store == NULL) thread_list_store = makeListStore();
+      return thread_list_store;
+   }
+   Bucket **store = __atomic_load_n(&list_store, __ATOMIC_ACQUIRE);
+   if(store != NULL) return store;
+   pthread_mutex_lock(&list_store_init_lock);
+   if(list_store == NULL) __atomic_store_n(&list_store, makeListStore(), __ATOMIC_RELEASE);
+   pthread_mutex_unlock(&list_store_init_lock);
+   return list_store;
+}
 
 /* The list hash table has 400 buckets. It is structured as follows:
  * Lists of length 1 occupy buckets 0 - 99.
@@ -110,35 +235,28 @@ static Bucket *makeBucket(HostAtom *array, int length, bool free_strings)
  * The free_strings flag is true if the strings in the passed array have already
  * been allocated by the caller. It controls the freeing of such strings in the
  * case that the passed list already exists in the hash table. 
- * This is a necessary inconvenience: addListToStore is called by the Bison/Flex generated
- * host graph parser which requires the strings it parses to be strdup'd (otherwise 
- * things go wrong). Calls to addListToStore in other contexts pass arrays with 
- * automatic strings which should not be freed. */
+ * Callers that build their arrays from automatic or borrowed strings, such as
+ * the host graph parser, whose strings live in its chunk buffers, pass false:
+ * the strings of a new list are then copied into the store. */
 HostList *makeHostList(HostAtom *array, int length, bool free_strings)
 {
    #ifdef LIST_HASHING
-      if(list_store == NULL)
-      {
-         list_store = calloc(LIST_TABLE_SIZE, sizeof(Bucket*));
-         if(list_store == NULL)
-         {
-            print_to_log("Error(addListToStore): malloc failure.\n");
-            exit(1);
-         }
-      }
+      Bucket **store = getListStore();
       int hash = hashHostList(array, length);
-      if(list_store[hash] == NULL)
+      LOCK_LIST_STORE(hash);
+      if(store[hash] == NULL)
       {
          Bucket *bucket = makeBucket(array, length, free_strings);
-         list_store[hash] = bucket;
+         store[hash] = bucket;
          bucket->list->hash = hash;
+         UNLOCK_LIST_STORE(hash);
          return bucket->list;
       }
       /* Check each list in the bucket for equality with the list represented
        * by the passed array. */
       else
       {
-         Bucket *bucket = list_store[hash];
+         Bucket *bucket = store[hash];
          int index;
          bool make_bucket = true;
          while(bucket != NULL)
@@ -183,6 +301,7 @@ HostList *makeHostList(HostAtom *array, int length, bool free_strings)
             bucket->next = new_bucket;
             new_bucket->prev = bucket;
             new_bucket->list->hash = hash;
+            UNLOCK_LIST_STORE(hash);
             return new_bucket->list;
          }
          else 
@@ -193,6 +312,7 @@ HostList *makeHostList(HostAtom *array, int length, bool free_strings)
                for(index = 0; index < length; index++) 
                   if(array[index].type == 's') free(array[index].str);
             }
+            UNLOCK_LIST_STORE(hash);
             return bucket->list;
          }
       }
@@ -209,7 +329,7 @@ HostList *makeHostList(HostAtom *array, int length, bool free_strings)
 /* Returns the bucket containing the passed list. */
 static Bucket *getBucket(HostList *list)
 {
-   Bucket *bucket = list_store[list->hash];
+   Bucket *bucket = getListStore()[list->hash];
    assert(bucket != NULL);
    while(bucket != NULL)
    {
@@ -220,12 +340,19 @@ static Bucket *getBucket(HostList *list)
 }
 
 void addHostList(HostList *list)
+{
+   addHostListReferences(list, 1);
+}
+
+void addHostListReferences(HostList *list, int count)
 {
    if(list == NULL) return;
+   LOCK_LIST_STORE(list->hash);
    Bucket *bucket = getBucket(list); 
    /* The passed list is expected to exist in the host table. */
    assert(bucket != NULL);
-   bucket->reference_count++;
+   bucket->reference_count += count;
+   UNLOCK_LIST_STORE(list->hash);
 }
 #endif
 
@@ -233,6 +360,9 @@ void removeHostList(HostList *list)
 {
    if(list == NULL) return;
    #ifdef LIST_HASHING
+      /* The list may be freed below. */
+      int hash = list->hash;
+      LOCK_LIST_STORE(hash);
       Bucket *bucket = getBucket(list); 
       /* The passed list is expected to exist in the host table. */
       assert(bucket != NULL);
@@ -240,12 +370,13 @@ void removeHostList(HostList *list)
       if(bucket->reference_count == 0)
       {
          /* Delete the bucket. */
-         if(bucket->prev == NULL) list_store[list->hash] = bucket->next;
+         if(bucket->prev == NULL) getListStore()[hash] = bucket->next;
          else bucket->prev->next = bucket->next;
          if(bucket->next != NULL) bucket->next->prev = bucket->prev;
          freeHostList(list);
          free(bucket);
       }
+      UNLOCK_LIST_STORE(hash);
    #else
       freeHostList(list);
    #endif
@@ -353,9 +484,30 @@ static void freeBuckets(Bucket *bucket)
 
 void freeHostListStore(void)
 {
-   if(list_store == NULL) return;
+   Bucket **store = list_store_mode == PER_THREAD_LIST_STORE ? thread_list_store : list_store;
+   if(store == NULL) return;
    int index;
-   for(index = 0; index < LIST_TABLE_SIZE; index++) freeBuckets(list_store[index]);
-   free(list_store);
+   for(index = 0; index < LIST_TABLE_SIZE; index++) freeBuckets(store[index]);
+   free(store);
+   if(list_store_mode == PER_THREAD_LIST_STORE) thread_list_store = NULL;
+   else list_store = NULL;
+}
+
+void printListStoreCounters(FILE *file)
+{
+   pthread_mutex_lock(&counters_lock);
+   unsigned long acquisitions = retired_acquisitions, contended = retired_contended;
+   LockCounters *counters;
+   for(counters = live_counters; counters != NULL; counters = counters->next)
+   {
+      acquisitions += __atomic_load_n(&counters->acquisitions, __ATOMIC_RELAXED);
+      contended += __atomic_load_n(&counters->contended, __ATOMIC_RELAXED);
+   }
+   pthread_mutex_unlock(&counters_lock);
+   if(acquisitions == 0) return;
+   fprintf(file, "List store counters (%d shards):\n\n", LIST_STORE_SHARDS);
+   fprintf(file, "%16lu      list-store-locks\n", acquisitions);
+   fprintf(file, "%16lu      list-store-contended-locks  #  %6.2f%% of all locks\n\n",
+           contended, 100.0 * contended / acquisitions);
 }
 #endif
@@ -75,6 +75,25 @@ typedef struct Bucket {
  * exactly once and has a single point of reference. */
 extern Bucket **list_store;
 
+/* Set while several threads match rules concurrently (see parallel.h). The
+ * functions below that change the list store then hold a lock, and the graph
+ * module does not cache the state it computes lazily. */
+extern bool concurrent_matching;
+
+/* How the list store is shared between threads. The mode is set before the first
+ * list is made and not changed while lists exist.
+ * SHARED_LIST_STORE: one store, locked only while concurrent_matching is set. This
+ *    is the default and the mode of the generated runtime.
+ * CONCURRENT_LIST_STORE: one store, always locked, for runtimes that are called
+ *    by several threads at once. The hash table is locked by shards, so threads
+ *    wait for each other only when their lists hash to the same shard.
+ * PER_THREAD_LIST_STORE: each thread makes lists in its own store, without locks.
+ *    Threads must not share graphs or lists, and each thread frees its own store
+ *    with freeHostListStore. */
+typedef enum {SHARED_LIST_STORE = 0, CONCURRENT_LIST_STORE, PER_THREAD_LIST_STORE}
+   ListStoreMode;
+extern ListStoreMode list_store_mode;
+
 /* If list hashing is enabled, makeHostList returns a pointer to the HostList represented 
  * by the passed array from the hash table (list_store). If not, the function returns a
  * pointer to a newly-allocated HostList. */
@@ -82,6 +101,8 @@ HostList *makeHostList(HostAtom *array, int length, bool free_strings);
 /* Expects the passed pointer to exist in the list hash table. Increments the reference
  * count of the list's bucket. */
 void addHostList(HostList *list);
+/* As addHostList, but adds count references at once. */
+void addHostListReferences(HostList *list, int count);
 /* Expects the passed pointer to exist in the list hash table. Decrements the reference
  * count of the list's bucket. Deletes/frees the list and its containing bucket if
  * the new reference count is 0. */
@@ -105,5 +126,9 @@ void printHostList(HostListItem *item, FILE *file);
 
 void freeHostList(HostList *list);
 void freeHostListStore(void);
+/* Prints the number of times the list store was locked and how many of those
+ * waited for another thread, in the style of perf stat. Prints nothing if the
+ * store was never locked. */
+void printListStoreCounters(FILE *file);
 
 #endif /* INC_LABEL_H */
@@ -0,0 +1,152 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "matchStore.h"
+
+/* Linked list of every match store created at runtime. */
+static MatchStore *match_stores = NULL;
+
+/* Frees the store's arrays and marks it as invalid. Matching functions test the
+ * valid flag and search the whole host graph from then on. */
+static void abandonMatchStore(MatchStore *store)
+{
+   print_to_log("Match store exceeded %d entries. Reverting to graph search.\n",
+                MATCH_STORE_LIMIT);
+   store->valid = false;
+   store->size = 0;
+   store->capacity = 0;
+   store->positions_size = 0;
+   free(store->items);
+   free(store->positions);
+   store->items = NULL;
+   store->positions = NULL;
+}
+
+/* Returns false if the array could not be grown without breaching the limit. */
+static bool growPositions(MatchStore *store, int index)
+{
+   int old_size = store->positions_size;
+   int new_size = old_size == 0 ? 128 : old_size;
+   while(new_size <= index) new_size *= 2;
+   if(new_size > MATCH_STORE_LIMIT) return false;
+   store->positions = realloc(store->positions, new_size * sizeof(int));
+   if(store->positions == NULL)
+   {
+      print_to_log("Error (growPositions): malloc failure.\n");
+      exit(1);
+   }
+   int i;
+   for(i = old_size; i < new_size; i++) store->positions[i] = -1;
+   store->positions_size = new_size;
+   return true;
+}
+
+static bool growItems(MatchStore *store)
+{
+   int new_capacity = store->capacity == 0 ? 128 : 2 * store->capacity;
+   if(new_capacity > MATCH_STORE_LIMIT) return false;
+   store->items = realloc(store->items, new_capacity * sizeof(int));
+   if(store->items == NULL)
+   {
+      print_to_log("Error (growItems): malloc failure.\n");
+      exit(1);
+   }
+   store->capacity = new_capacity;
+   return true;
+}
+
+static void addToMatchStore(MatchStore *store, int index)
+{
+   if(index >= store->positions_size && !growPositions(store, index))
+   {
+      abandonMatchStore(store);
+      return;
+   }
+   if(store->positions[index] >= 0) return;
+   if(store->size >= store->capacity && !growItems(store))
+   {
+      abandonMatchStore(store);
+      return;
+   }
+   store->positions[index] = store->size;
+   store->items[store->size++] = index;
+}
+
+/* The last item is moved into the slot of the removed item. */
+static void removeFromMatchStore(MatchStore *store, int index)
+{
+   if(index >= store->positions_size) return;
+   int position = store->positions[index];
+   if(position < 0) return;
+   int last = store->items[--store->size];
+   store->items[position] = last;
+   store->positions[last] = position;
+   store->positions[index] = -1;
+}
+
+static void updateMatchStore(MatchStore *store, int index)
+{
+   Node *node = NULL;
+   if(index < store->graph->nodes.size) node = getNode(store->graph, index);
+   if(node != NULL && node->index >= 0 && store->filter(node))
+      addToMatchStore(store, index);
+   else removeFromMatchStore(store, index);
+}
+
+MatchStore *makeMatchStore(Graph *graph, NodeFilter filter)
+{
+   MatchStore *store = malloc(sizeof(MatchStore));
+   if(store == NULL)
+   {
+      print_to_log("Error (makeMatchStore): malloc failure.\n");
+      exit(1);
+   }
+   store->graph = graph;
+   store->filter = filter;
+   store->valid = true;
+   store->size = 0;
+   store->capacity = 0;
+   store->items = NULL;
+   store->positions_size = 0;
+   store->positions = NULL;
+   store->next = match_stores;
+   match_stores = store;
+   node_change_hook = updateMatchStores;
+
+   int index;
+   for(index = 0; index < graph->nodes.size && store->valid; index++)
+      updateMatchStore(store, index);
+   return store;
+}
+
+void updateMatchStores(Graph *graph, int index)
+{
+   MatchStore *store;
+   for(store = match_stores; store != NULL; store = store->next)
+      if(store->valid && store->graph == graph) updateMatchStore(store, index);
+}
+
+void freeMatchStores(void)
+{
+   while(match_stores != NULL)
+   {
+      MatchStore *store = match_stores;
+      match_stores = store->next;
+      if(store->items != NULL) free(store->items);
+      if(store->positions != NULL) free(store->positions);
+      free(store);
+   }
+   node_change_hook = NULL;
+}
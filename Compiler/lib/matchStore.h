@@ -0,0 +1,74 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ==================
+  Match Store Module
+  ==================
+
+  Incremental match maintenance for rules called inside loops (compiler flag
+  -I). A match store holds the partial matches of the first operation of a
+  rule's searchplan: the host nodes that pass the tests of the first LHS node
+  that do not depend on the rest of the match (mark, degree and list length).
+  The stores are kept up to date by the graph module, which reports every
+  node whose state changes, so the first matching function of a rule iterates
+  over the store instead of the whole node array.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_MATCH_STORE_H
+#define INC_MATCH_STORE_H
+
+#include "globals.h"
+#include "graph.h"
+
+/* The maximum number of entries in either array of a match store. If a store
+ * needs to grow beyond this size, it is abandoned and the rule falls back to
+ * searching the whole host graph for the rest of the execution. */
+#define MATCH_STORE_LIMIT 1048576
+
+/* Tests a host node against the first searchplan operation of a rule. */
+typedef bool (*NodeFilter)(Node *node);
+
+/* items - The host indices of the nodes that pass the store's filter. The
+ *         order of the items is not significant.
+ * positions - Indexed by host node index. Stores the position of the node in
+ *             the items array, or -1 if the node is not in the store. Used
+ *             to update and remove entries in constant time.
+ * valid - Set to false when the store is abandoned. */
+typedef struct MatchStore {
+   Graph *graph;
+   NodeFilter filter;
+   bool valid;
+   int size, capacity;
+   int *items;
+   int positions_size;
+   int *positions;
+   struct MatchStore *next;
+} MatchStore;
+
+/* Creates a match store for the passed graph and populates it by testing every
+ * node in the graph. The store is registered with the graph module so that it is
+ * updated whenever the graph changes. */
+MatchStore *makeMatchStore(Graph *graph, NodeFilter filter);
+
+/* Called by the graph module (through node_change_hook) with the index of every
+ * node that is added, removed, relabelled, remarked, (un)rooted or whose degree
+ * changes. Each valid store on the graph retests the node and updates itself. */
+void updateMatchStores(Graph *graph, int index);
+void freeMatchStores(void);
+
+#endif /* INC_MATCH_STORE_H */
@@ -238,6 +238,22 @@ int lookupEdge(Morphism *morphism, int left_index)
    return morphism->edge_map[left_index].host_index;
 }
 
+bool nodeInImage(Morphism *morphism, int host_index)
+{
+   int index;
+   for(index = 0; index < morphism->nodes; index++)
+      if(morphism->node_map[index].host_index == host_index) return true;
+   return false;
+}
+
+bool edgeInImage(Morphism *morphism, int host_index)
+{
+   int index;
+   for(index = 0; index < morphism->edges; index++)
+      if(morphism->edge_map[index].host_index == host_index) return true;
+   return false;
+}
+
 int getIntegerValue(Morphism *morphism, int id)
 {
    assert(id < morphism->variables);
@@ -102,6 +102,11 @@ int popVariableId(Morphism *morphism);
 
 int lookupNode(Morphism *morphism, int left_index);
 int lookupEdge(Morphism *morphism, int left_index);
+/* Return true if the host item is the image of some LHS item. Used instead of
+ * the matched flags of the host graph by rules matched on several threads
+ * (see parallel.h). */
+bool nodeInImage(Morphism *morphism, int host_index);
+bool edgeInImage(Morphism *morphism, int host_index);
 
 /* These functions expect to be passed the id of a variable of the appropriate type. */
 int getIntegerValue(Morphism *morphism, int id);
@@ -0,0 +1,304 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "parallel.h"
+#include "adjacency.h"
+#include <pthread.h>
+
+int worker_threads = 1;
+bool concurrent_matching = false;
+
+/* The state shared by the threads of one search. next_block is the first node
+ * of the next unclaimed block. winner is the number of the thread whose
+ * morphism holds the match, or -1. */
+typedef struct Search {
+   Graph *graph;
+   NodeTester tester;
+   int next_block;
+   int winner;
+} Search;
+
+typedef struct Worker {
+   Search *search;
+   int number;
+   Morphism *morphism;
+} Worker;
+
+/* Runs the routine on each of the threads workers, of the given size. The
+ * calling thread runs the first worker. If a thread cannot be started, the
+ * work of its worker is done by the others. */
+static void runWorkers(int threads, void *(*routine)(void *), void *workers, size_t size)
+{
+   pthread_t handles[threads];
+   bool started[threads];
+   int number;
+   for(number = 1; number < threads; number++)
+      started[number] = pthread_create(&handles[number], NULL, routine,
+                                       (char *)workers + number * size) == 0;
+   routine(workers);
+   for(number = 1; number < threads; number++)
+      if(started[number]) pthread_join(handles[number], NULL);
+}
+
+static void *searchBlocks(void *argument)
+{
+   Worker *worker = argument;
+   Search *search = worker->search;
+   while(__atomic_load_n(&(search->winner), __ATOMIC_ACQUIRE) < 0)
+   {
+      int block = __atomic_fetch_add(&(search->next_block), PARALLEL_BLOCK,
+                                     __ATOMIC_RELAXED);
+      if(block >= search->graph->nodes.size) break;
+      int end = block + PARALLEL_BLOCK;
+      if(end > search->graph->nodes.size) end = search->graph->nodes.size;
+      int index;
+      for(index = block; index < end; index++)
+      {
+         if(__atomic_load_n(&(search->winner), __ATOMIC_RELAXED) >= 0) return NULL;
+         Node *node = getNode(search->graph, index);
+         if(node->index == -1) continue;
+         if(search->tester(worker->morphism, node))
+         {
+            /* If another thread won first, the match is discarded when the
+             * morphism is freed. */
+            int none = -1;
+            __atomic_compare_exchange_n(&(search->winner), &none, worker->number,
+                                        false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            return NULL;
+         }
+      }
+   }
+   return NULL;
+}
+
+bool matchInParallel(Graph *graph, Morphism *morphism, NodeTester tester)
+{
+   int threads = worker_threads > 1 ? worker_threads : 1;
+   Search search = {graph, tester, 0, -1};
+   Worker workers[threads];
+   /* The adjacency bitmap is built here if the graph fits within the budget,
+    * since the threads only read it. */
+   if(graph->nodes.size > 0) mayBeAdjacent(graph, 0, 0);
+
+   concurrent_matching = true;
+   int number;
+   for(number = 0; number < threads; number++)
+   {
+      workers[number].search = &search;
+      workers[number].number = number;
+      workers[number].morphism = makeMorphism(morphism->nodes, morphism->edges,
+                                              morphism->variables);
+   }
+   runWorkers(threads, searchBlocks, workers, sizeof(Worker));
+   concurrent_matching = false;
+
+   if(search.winner >= 0)
+   {
+      Morphism *result = workers[search.winner].morphism;
+      Morphism swap = *result;
+      *result = *morphism;
+      *morphism = swap;
+   }
+   for(number = 0; number < threads; number++) freeMorphism(workers[number].morphism);
+   return search.winner >= 0;
+}
+
+/* The values of the claim arrays of a match batch. A host item matched by a
+ * match of the batch is claimed exclusively, unless it is a node matched by a
+ * sharable LHS node in every match that matches it. */
+#define UNCLAIMED 0
+#define SHARED_CLAIM 1
+#define EXCLUSIVE_CLAIM 2
+
+static MatchBatch *match_batches = NULL;
+
+MatchBatch *makeMatchBatch(int nodes, int edges, int variables,
+                           unsigned long long sharable_nodes)
+{
+   MatchBatch *batch = malloc(sizeof(MatchBatch));
+   if(batch == NULL)
+   {
+      print_to_log("Error (makeMatchBatch): malloc failure.\n");
+      exit(1);
+   }
+   batch->size = 0;
+   batch->capacity = 0;
+   batch->matches = NULL;
+   batch->nodes = nodes;
+   batch->edges = edges;
+   batch->variables = variables;
+   batch->sharable_nodes = sharable_nodes;
+   batch->node_capacity = 0;
+   batch->edge_capacity = 0;
+   batch->node_claims = NULL;
+   batch->edge_claims = NULL;
+   batch->next = match_batches;
+   match_batches = batch;
+   return batch;
+}
+
+static unsigned char *resetClaims(unsigned char *claims, int *capacity, int size)
+{
+   if(size > *capacity)
+   {
+      free(claims);
+      *capacity = size;
+      claims = malloc(size);
+      if(claims == NULL)
+      {
+         print_to_log("Error (collectMatches): malloc failure.\n");
+         exit(1);
+      }
+   }
+   if(size > 0) memset(claims, UNCLAIMED, size);
+   return claims;
+}
+
+/* Adds the match in the morphism to the batch if it does not conflict with the
+ * claims of the batch. Returns true if the match was added. Called with the
+ * lock of the collection held. */
+static bool claimMatch(MatchBatch *batch, Morphism *morphism)
+{
+   int index;
+   for(index = 0; index < batch->nodes; index++)
+   {
+      int host_index = morphism->node_map[index].host_index;
+      bool sharable = index < 64 && (batch->sharable_nodes >> index) & 1;
+      unsigned char claim = batch->node_claims[host_index];
+      if(claim == EXCLUSIVE_CLAIM || (claim == SHARED_CLAIM && !sharable)) return false;
+   }
+   for(index = 0; index < batch->edges; index++)
+      if(batch->edge_claims[morphism->edge_map[index].host_index] != UNCLAIMED)
+         return false;
+
+   for(index = 0; index < batch->nodes; index++)
+   {
+      int host_index = morphism->node_map[index].host_index;
+      bool sharable = index < 64 && (batch->sharable_nodes >> index) & 1;
+      __atomic_store_n(&(batch->node_claims[host_index]),
+                       sharable ? SHARED_CLAIM : EXCLUSIVE_CLAIM, __ATOMIC_RELAXED);
+   }
+   for(index = 0; index < batch->edges; index++)
+      batch->edge_claims[morphism->edge_map[index].host_index] = EXCLUSIVE_CLAIM;
+   return true;
+}
+
+/* The state shared by the threads collecting a batch. */
+typedef struct Collection {
+   Graph *graph;
+   NodeTester tester;
+   MatchBatch *batch;
+   int next_block;
+   pthread_mutex_t lock;
+} Collection;
+
+typedef struct Collector {
+   Collection *collection;
+   Morphism *morphism;
+} Collector;
+
+static void *collectBlocks(void *argument)
+{
+   Collector *collector = argument;
+   Collection *collection = collector->collection;
+   MatchBatch *batch = collection->batch;
+   while(true)
+   {
+      int block = __atomic_fetch_add(&(collection->next_block), PARALLEL_BLOCK,
+                                     __ATOMIC_RELAXED);
+      if(block >= collection->graph->nodes.size) break;
+      int end = block + PARALLEL_BLOCK;
+      if(end > collection->graph->nodes.size) end = collection->graph->nodes.size;
+      int index;
+      for(index = block; index < end; index++)
+      {
+         Node *node = getNode(collection->graph, index);
+         if(node->index == -1) continue;
+         /* A node claimed exclusively cannot start another match of the batch. */
+         if(__atomic_load_n(&(batch->node_claims[index]), __ATOMIC_RELAXED) ==
+            EXCLUSIVE_CLAIM) continue;
+         if(!collection->tester(collector->morphism, node)) continue;
+
+         pthread_mutex_lock(&(collection->lock));
+         if(claimMatch(batch, collector->morphism))
+         {
+            if(batch->size == batch->capacity)
+            {
+               batch->capacity = batch->capacity == 0 ? 16 : 2 * batch->capacity;
+               batch->matches = realloc(batch->matches, batch->capacity * sizeof(Morphism *));
+               if(batch->matches == NULL)
+               {
+                  print_to_log("Error (collectMatches): malloc failure.\n");
+                  exit(1);
+               }
+               int spare;
+               for(spare = batch->size; spare < batch->capacity; spare++)
+                  batch->matches[spare] = makeMorphism(batch->nodes, batch->edges,
+                                                       batch->variables);
+            }
+            /* The collector continues with the unused morphism of the slot. */
+            Morphism *unused = batch->matches[batch->size];
+            batch->matches[batch->size++] = collector->morphism;
+            collector->morphism = unused;
+         }
+         else initialiseMorphism(collector->morphism, NULL);
+         pthread_mutex_unlock(&(collection->lock));
+      }
+   }
+   return NULL;
+}
+
+void collectMatches(Graph *graph, MatchBatch *batch, NodeTester tester)
+{
+   batch->size = 0;
+   batch->node_claims = resetClaims(batch->node_claims, &(batch->node_capacity),
+                                    graph->nodes.size);
+   batch->edge_claims = resetClaims(batch->edge_claims, &(batch->edge_capacity),
+                                    graph->edges.size);
+   int threads = 1;
+   if(worker_threads > 1 && graph->nodes.size >= PARALLEL_THRESHOLD)
+   {
+      threads = worker_threads;
+      mayBeAdjacent(graph, 0, 0);
+      concurrent_matching = true;
+   }
+   Collection collection = {graph, tester, batch, 0, PTHREAD_MUTEX_INITIALIZER};
+   Collector collectors[threads];
+   int number;
+   for(number = 0; number < threads; number++)
+   {
+      collectors[number].collection = &collection;
+      collectors[number].morphism = makeMorphism(batch->nodes, batch->edges,
+                                                 batch->variables);
+   }
+   runWorkers(threads, collectBlocks, collectors, sizeof(Collector));
+   concurrent_matching = false;
+   for(number = 0; number < threads; number++) freeMorphism(collectors[number].morphism);
+}
+
+void freeMatchBatches(void)
+{
+   while(match_batches != NULL)
+   {
+      MatchBatch *batch = match_batches;
+      match_batches = batch->next;
+      int index;
+      for(index = 0; index < batch->capacity; index++) freeMorphism(batch->matches[index]);
+      free(batch->matches);
+      free(batch->node_claims);
+      free(batch->edge_claims);
+      free(batch);
+   }
+}
@@ -0,0 +1,99 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ========================
+  Parallel Matching Module
+  ========================
+
+  Searches large host graphs for a match of a rule on several threads
+  (compiler flag -T). The node array is divided into blocks, which the
+  threads claim in turn. Each thread tests the nodes of its blocks as the
+  match of the first node of the rule's searchplan, using the generated
+  function that completes the match from a given host node, and its own
+  morphism. The first thread to find a match stops the others.
+
+  The module also collects batches of matches for loops whose body is a
+  single rule call (compiler flag -b). The matches of a batch do not overlap,
+  except in host nodes matched by LHS nodes that the rule leaves unchanged
+  and whose degree it does not use (see isSharableNode in rule.h). Applying
+  them one after the other therefore has the same effect as some sequential
+  execution of the loop. Batches of large host graphs are collected by
+  several threads.
+
+  The generated matching functions of such rules test whether a host item is
+  already in the morphism instead of using the matched flags of the host
+  graph, which are shared by the threads, and keep the results of the
+  condition's predicates in thread-local variables.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_PARALLEL_H
+#define INC_PARALLEL_H
+
+#include "globals.h"
+#include "graph.h"
+#include "morphism.h"
+
+/* The number of threads used by parallel matching. Set by the generated main
+ * function. A value of 1 or less disables parallel matching. */
+extern int worker_threads;
+
+/* Host graphs with fewer nodes are searched on the calling thread: starting
+ * the threads would cost more than the search. */
+#define PARALLEL_THRESHOLD 65536
+/* The number of nodes claimed by a thread at a time. */
+#define PARALLEL_BLOCK 1024
+
+/* Completes a match from the host node, which is tested as the match of the
+ * first node of the searchplan. Returns true with the match in the morphism,
+ * or false with the morphism unchanged. */
+typedef bool (*NodeTester)(Morphism *morphism, Node *node);
+
+/* Searches the graph with the tester on worker_threads threads, each with a
+ * morphism of the same size as the passed morphism. If some thread finds a
+ * match, its morphism is swapped with the passed morphism and true is
+ * returned. Which match is found depends on the scheduling of the threads.
+ * concurrent_matching (see label.h) is set while the threads run. */
+bool matchInParallel(Graph *graph, Morphism *morphism, NodeTester tester);
+
+/* matches[0] to matches[size - 1] are the matches of the batch. The morphisms
+ * from matches[size] to matches[capacity - 1] are unused. Bit i of
+ * sharable_nodes is set if LHS node i may match a host node that is also
+ * matched by other matches of the batch. node_claims and edge_claims record,
+ * for each host item, whether it is matched by the batch (see parallel.c).
+ * The batches are kept in a list so that they can be freed at the end of the
+ * program. */
+typedef struct MatchBatch {
+   int size, capacity;
+   Morphism **matches;
+   int nodes, edges, variables;
+   unsigned long long sharable_nodes;
+   int node_capacity, edge_capacity;
+   unsigned char *node_claims, *edge_claims;
+   struct MatchBatch *next;
+} MatchBatch;
+
+/* The first three arguments are the dimensions of the rule's morphisms. */
+MatchBatch *makeMatchBatch(int nodes, int edges, int variables,
+                           unsigned long long sharable_nodes);
+/* Replaces the matches of the batch with a batch of matches in the graph, found
+ * by testing each node with the tester. The batch is empty only if the rule
+ * has no match. The caller applies the matches, which resets their morphisms. */
+void collectMatches(Graph *graph, MatchBatch *batch, NodeTester tester);
+void freeMatchBatches(void);
+
+#endif /* INC_PARALLEL_H */
@@ -0,0 +1,133 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "speculation.h"
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+/* The number of unconfirmed speculations in the ancestry of a process is
+ * bounded; deeper try statements are not run speculatively. */
+#define MAX_SPECULATION_DEPTH 32
+
+/* A speculative process waits on a channel for one byte confirming it, or for
+ * the end of the channel if it is abandoned. The end is also seen by the
+ * processes the abandoned process started, since only the parent holds the
+ * sending side. */
+
+/* The speculative child of this process and the sending side of its channel,
+ * or -1. */
+static pid_t speculative_child = -1;
+static int child_channel = -1;
+
+/* The receiving sides of the channels of the speculations that started this
+ * process, outermost first, or -1 once confirmed. */
+static int channels[MAX_SPECULATION_DEPTH];
+static int channel_count = 0;
+
+/* Returns false if the speculation with the channel has been abandoned. Waits
+ * for the decision if wait is set; otherwise a pending channel counts as not
+ * abandoned. A confirmed channel is closed and set to -1. */
+static bool checkChannel(int index, bool wait)
+{
+   if(channels[index] < 0) return true;
+   if(!wait)
+   {
+      struct pollfd channel = {channels[index], POLLIN, 0};
+      if(poll(&channel, 1, 0) <= 0) return true;
+   }
+   char confirmation;
+   ssize_t count;
+   do count = recv(channels[index], &confirmation, 1, 0);
+   while(count < 0 && errno == EINTR);
+   if(count != 1) return false;
+   close(channels[index]);
+   channels[index] = -1;
+   return true;
+}
+
+/* A process whose speculation was abandoned has nothing left to do, since its
+ * output would never be used. It leaves as soon as it notices. */
+static void leaveIfAbandoned(void)
+{
+   int index;
+   for(index = 0; index < channel_count; index++)
+      if(!checkChannel(index, false)) _exit(0);
+}
+
+bool beginSpeculation(void)
+{
+   leaveIfAbandoned();
+   if(speculative_child >= 0 || channel_count == MAX_SPECULATION_DEPTH) return false;
+   int channel[2];
+   if(socketpair(AF_UNIX, SOCK_STREAM, 0, channel) < 0) return false;
+   /* Buffered output would otherwise be written by both processes. */
+   fflush(NULL);
+   pid_t pid = fork();
+   if(pid < 0)
+   {
+      close(channel[0]);
+      close(channel[1]);
+      return false;
+   }
+   if(pid == 0)
+   {
+      close(channel[1]);
+      channels[channel_count++] = channel[0];
+      return true;
+   }
+   close(channel[0]);
+   speculative_child = pid;
+   child_channel = channel[1];
+   return false;
+}
+
+void endSpeculation(bool condition_succeeded)
+{
+   leaveIfAbandoned();
+   if(speculative_child < 0) return;
+   pid_t child = speculative_child;
+   speculative_child = -1;
+   if(condition_succeeded)
+   {
+      close(child_channel);
+      kill(child, SIGKILL);
+      waitpid(child, NULL, 0);
+      return;
+   }
+   /* A child that has already exited is not confirmed, but its status is
+    * still passed on. */
+   char confirmation = 1;
+   send(child_channel, &confirmation, 1, MSG_NOSIGNAL);
+   close(child_channel);
+   int status;
+   while(waitpid(child, &status, 0) < 0)
+   {
+      if(errno != EINTR) _exit(1);
+   }
+   /* Anything this process buffered since the fork came from the condition,
+    * whose effects the child does not have, so it is discarded. */
+   _exit(WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+}
+
+void confirmSpeculation(void)
+{
+   int index;
+   for(index = 0; index < channel_count; index++)
+      if(!checkChannel(index, true)) _exit(0);
+   channel_count = 0;
+}
@@ -0,0 +1,64 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ===================
+  Speculation Module
+  ===================
+
+  Runs the else branch of a try statement speculatively while its condition
+  is evaluated (compiler flag -S). The runtime forks when the try statement
+  begins, which gives the new process a copy-on-write snapshot of the host
+  graph (for why processes are used, see workers.h). The parent process evaluates
+  the condition; the speculative process skips it and runs the else branch
+  and the rest of the program on the snapshot.
+
+  If the condition succeeds, the parent kills the speculative process and
+  runs the then branch. If it fails, the snapshot is exactly the graph that
+  the else branch would be run on after the condition's changes are undone,
+  so the parent lets the speculative process continue in its place, waits
+  for it and exits with its status. A speculative process waits for this
+  decision before anything leaves the process: confirmSpeculation is called
+  before the output is printed. A speculative process also checks, whenever
+  it begins or ends a speculation of its own, whether a speculation that
+  started it has been abandoned, and exits at once if so.
+
+  A process started speculatively may itself speculate, but the generated
+  code never starts a speculation while the condition of another one is
+  being evaluated, so each process has at most one speculative child
+  waiting for a decision.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_SPECULATION_H
+#define INC_SPECULATION_H
+
+#include "globals.h"
+
+/* Forks a speculative process. Returns true in the speculative process and
+ * false in the parent, which also runs the condition if the fork fails. */
+bool beginSpeculation(void);
+
+/* Called by the parent once the condition has been evaluated. If it failed,
+ * the speculative process continues the program and this function does not
+ * return. */
+void endSpeculation(bool condition_succeeded);
+
+/* Waits until the speculations that started this process are confirmed.
+ * The process exits if one of them was abandoned. */
+void confirmSpeculation(void);
+
+#endif /* INC_SPECULATION_H */
@@ -0,0 +1,66 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "workers.h"
+#include <sys/wait.h>
+
+void runWorkers(int workers, int files_per_worker, FILE **files, WorkerTask task,
+                void *data, string kind)
+{
+   pid_t pids[workers];
+   int worker, index;
+   for(index = 0; index < workers * files_per_worker; index++)
+   {
+      files[index] = tmpfile();
+      if(files[index] == NULL)
+      {
+         perror("runWorkers");
+         exit(1);
+      }
+   }
+   /* Buffered output would otherwise be written by every worker. */
+   fflush(NULL);
+   for(worker = 0; worker < workers; worker++)
+   {
+      FILE **worker_files = files + worker * files_per_worker;
+      pids[worker] = workers > 1 ? fork() : -1;
+      if(pids[worker] == 0)
+      {
+         task(worker, workers, worker_files, data);
+         fflush(NULL);
+         _exit(0);
+      }
+      if(pids[worker] < 0)
+      {
+         task(worker, workers, worker_files, data);
+         for(index = 0; index < files_per_worker; index++) fflush(worker_files[index]);
+      }
+   }
+   for(worker = 0; worker < workers; worker++)
+   {
+      if(pids[worker] < 0) continue;
+      int status;
+      if(waitpid(pids[worker], &status, 0) < 0 || !WIFEXITED(status) ||
+         WEXITSTATUS(status) != 0)
+      {
+         print_to_log("Error (runWorkers): %s worker %d failed.\n", kind, worker);
+         fprintf(stderr, "Error: a %s worker failed. Execution aborted.\n", kind);
+         exit(1);
+      }
+   }
+   /* The file offsets are shared with the forked workers, so the files are
+    * rewound only once every worker has finished. */
+   for(index = 0; index < workers * files_per_worker; index++) rewind(files[index]);
+}
@@ -0,0 +1,48 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ==============
+  Workers Module
+  ==============
+
+  The worker pool of component execution (see components.h) and batch mode
+  (see batch.h). The runtime keeps its state (host graph, morphisms, list
+  store, change stack) in global variables, so the workers are forked
+  processes rather than threads: each has its own copy of the state, and
+  passes its results back to the parent through temporary files.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_WORKERS_H
+#define INC_WORKERS_H
+
+#include "globals.h"
+
+/* Runs the work of one worker. Worker w of n writes its results to its
+ * temporary files, files[0] to files[k - 1] for k files per worker. */
+typedef void (*WorkerTask)(int worker, int workers, FILE **files, void *data);
+
+/* Creates files_per_worker temporary files for each worker, storing the files
+ * of worker w at files[w * files_per_worker] onwards, and runs the task of
+ * each worker in a forked process. A single worker, or one that cannot be
+ * forked, runs in the calling process. Returns when every worker has finished,
+ * with the files rewound for reading; the caller closes them. Exits if a
+ * worker fails, naming the kind of worker in the error message. */
+void runWorkers(int workers, int files_per_worker, FILE **files, WorkerTask task,
+                void *data, string kind);
+
+#endif /* INC_WORKERS_H */
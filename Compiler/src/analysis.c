@@ -18,6 +18,7 @@
 typedef enum {NO_BACKTRACK = 0, RECORD_CHANGES, COPY} copyType;
 
 static void annotate(GPCommand *command, bool in_loop);
+static void annotateRuleCall(GPCommand *command, bool in_loop);
 static bool getIfCommandType(GPCommand *command);
 static bool getTryLoopCommandType(GPCommand *command, bool first_sequence,
                                   bool first_command);
@@ -54,6 +55,221 @@ void staticAnalysis(List *declarations)
    }
 }
 
+void annotateRuleCalls(List *declarations)
+{
+   List *iterator = declarations;
+   while(iterator != NULL)
+   {
+      GPDeclaration *decl = iterator->declaration;
+      if(decl->type == MAIN_DECLARATION) annotateRuleCall(decl->main_program, false);
+      iterator = iterator->next;
+   }
+}
+
+bool hasRootedLHS(GPRule *rule)
+{
+   if(rule->lhs == NULL) return false;
+   List *nodes = rule->lhs->nodes;
+   while(nodes != NULL)
+   {
+      if(nodes->node->root) return true;
+      nodes = nodes->next;
+   }
+   return false;
+}
+
+bool isSharedRuleSet(List *rules)
+{
+   if(!shared_rule_sets) return false;
+   if(program_tracing || incremental_matching || locality_matching) return false;
+   if(rules == NULL || rules->next == NULL) return false;
+   bool rooted = hasRootedLHS(rules->rule_call.rule);
+   while(rules != NULL)
+   {
+      GPRule *rule = rules->rule_call.rule;
+      if(rule->left_nodes == 0) return false;
+      if(hasRootedLHS(rule) != rooted) return false;
+      rules = rules->next;
+   }
+   return true;
+}
+
+bool isReorderedRuleSet(List *rules)
+{
+   if(rule_set_policy == SOURCE_ORDER) return false;
+   if(rules == NULL || rules->next == NULL) return false;
+   while(rules != NULL)
+   {
+      if(rules->rule_call.rule->left_nodes == 0) return false;
+      rules = rules->next;
+   }
+   return true;
+}
+
+/* Returns the position of the named node in the list, or -1. */
+static int nodePosition(List *nodes, string name)
+{
+   int position = 0;
+   while(nodes != NULL)
+   {
+      if(strcmp(nodes->node->name, name) == 0) return position;
+      position++;
+      nodes = nodes->next;
+   }
+   return -1;
+}
+
+/* Returns true if the rule has a non-empty LHS whose nodes are connected when
+ * edge directions are ignored. The nodes reached from the first node are
+ * marked until no edge joins a marked and an unmarked node. */
+static bool hasConnectedLHS(GPRule *rule)
+{
+   if(rule->lhs == NULL || rule->lhs->nodes == NULL) return false;
+   int node_count = countNodes(rule->lhs);
+   bool reached[node_count];
+   memset(reached, 0, sizeof(reached));
+   reached[0] = true;
+   int reached_count = 1;
+   bool changed = true;
+   while(changed)
+   {
+      changed = false;
+      List *edges = rule->lhs->edges;
+      while(edges != NULL)
+      {
+         int source = nodePosition(rule->lhs->nodes, edges->edge->source);
+         int target = nodePosition(rule->lhs->nodes, edges->edge->target);
+         if(source >= 0 && target >= 0 && reached[source] != reached[target])
+         {
+            reached[source] = reached[target] = true;
+            reached_count++;
+            changed = true;
+         }
+         edges = edges->next;
+      }
+   }
+   return reached_count == node_count;
+}
+
+static bool isComponentLocalCommand(GPCommand *command)
+{
+   switch(command->type)
+   {
+      case COMMAND_SEQUENCE:
+      {
+           List *commands = command->commands;
+           while(commands != NULL)
+           {
+              if(!isComponentLocalCommand(commands->command)) return false;
+              commands = commands->next;
+           }
+           return true;
+      }
+      case PROCEDURE_CALL:
+           return isComponentLocalCommand(command->proc_call.procedure->commands);
+
+      case ALAP_STATEMENT:
+      {
+           GPCommand *body = command->loop_stmt.loop_body;
+           while(body->type == COMMAND_SEQUENCE && body->commands != NULL &&
+                 body->commands->next == NULL) body = body->commands->command;
+           if(body->type == RULE_CALL) return hasConnectedLHS(body->rule_call.rule);
+           if(body->type != RULE_SET_CALL) return false;
+           List *rules = body->rule_set;
+           while(rules != NULL)
+           {
+              if(!hasConnectedLHS(rules->rule_call.rule)) return false;
+              rules = rules->next;
+           }
+           return true;
+      }
+      case SKIP_STATEMENT:
+           return true;
+
+      default:
+           return false;
+   }
+}
+
+bool isComponentLocal(List *declarations)
+{
+   List *iterator = declarations;
+   while(iterator != NULL)
+   {
+      GPDeclaration *decl = iterator->declaration;
+      if(decl->type == MAIN_DECLARATION) return isComponentLocalCommand(decl->main_program);
+      iterator = iterator->next;
+   }
+   return false;
+}
+
+static void annotateRuleCall(GPCommand *command, bool in_loop)
+{
+   switch(command->type)
+   {
+      case COMMAND_SEQUENCE:
+      {
+           List *commands = command->commands;
+           while(commands != NULL)
+           {
+              annotateRuleCall(commands->command, in_loop);
+              commands = commands->next;
+           }
+           break;
+      }
+      case RULE_CALL:
+           if(in_loop) command->rule_call.rule->looped = true;
+           break;
+
+      case RULE_SET_CALL:
+      {
+           bool shared = isSharedRuleSet(command->rule_set);
+           List *rules = command->rule_set;
+           while(rules != NULL)
+           {
+              if(in_loop) rules->rule_call.rule->looped = true;
+              if(shared) rules->rule_call.rule->in_shared_set = true;
+              rules = rules->next;
+           }
+           break;
+      }
+      case PROCEDURE_CALL:
+           annotateRuleCall(command->proc_call.procedure->commands, in_loop);
+           break;
+
+      case IF_STATEMENT:
+      case TRY_STATEMENT:
+           annotateRuleCall(command->cond_branch.condition, in_loop);
+           annotateRuleCall(command->cond_branch.then_command, in_loop);
+           annotateRuleCall(command->cond_branch.else_command, in_loop);
+           break;
+
+      case ALAP_STATEMENT:
+      {
+           GPCommand *body = command->loop_stmt.loop_body;
+           while(body->type == COMMAND_SEQUENCE && body->commands != NULL &&
+                 body->commands->next == NULL) body = body->commands->command;
+           if(body->type == RULE_CALL) body->rule_call.rule->loop_body = true;
+           annotateRuleCall(command->loop_stmt.loop_body, true);
+           break;
+      }
+      case PROGRAM_OR:
+           annotateRuleCall(command->or_stmt.left_command, in_loop);
+           annotateRuleCall(command->or_stmt.right_command, in_loop);
+           break;
+
+      case BREAK_STATEMENT:
+      case SKIP_STATEMENT:
+      case FAIL_STATEMENT:
+           break;
+
+      default:
+           print_to_log("Error (annotateRuleCall): Unexpected command type %d.\n",
+                        command->type);
+           break;
+   }
+}
+
 /* Searches for conditional branching statements and loop bodies so that they 
  * can be analysed with respect to host graph backtracking. */
 static void annotate(GPCommand *command, bool in_loop)
@@ -33,6 +33,43 @@
 
 void staticAnalysis(List *declarations);
 
+/* Sets the looped flag of each rule that is called, directly or through a 
+ * procedure, inside a loop body, the loop_body flag of each rule whose call is
+ * the whole body of a loop, and the in_shared_set flag of each rule called in a
+ * shared rule set. The looped flag decides which rules are given a match
+ * store or locality-seeded matching code (compiler flags -I and -l). Unlike
+ * staticAnalysis, this does not depend on the rule annotations made during rule
+ * code generation. */
+void annotateRuleCalls(List *declarations);
+
+/* With compiler flag -m, a rule set call is shared if it contains at least two
+ * rules, every rule has a non-empty LHS, and either every LHS or no LHS
+ * contains a root node. The first searchplan operation of all these rules then
+ * draws its candidates from the same host nodes (the root nodes or all nodes),
+ * so the rule set is matched by a single scan of these nodes. The rules are
+ * grouped by the host marks their first LHS node accepts, and the scan tests
+ * the mark of each node once to select the group of rules tried at the node.
+ * Shared rule sets are not used with program
+ * tracing, incremental matching or locality-seeded matching, which have their
+ * own treatment of the first searchplan operation. */
+bool isSharedRuleSet(List *rules);
+
+/* A rule set call is reordered at runtime according to the rule set policy
+ * (compiler flag -s) if the policy is not SOURCE_ORDER, the set contains at
+ * least two rules and every rule has a non-empty LHS. */
+bool isReorderedRuleSet(List *rules);
+bool hasRootedLHS(GPRule *rule);
+
+/* A program is component-local if its main body is a sequence of loops whose
+ * bodies are single calls of rules or rule sets, possibly through procedure
+ * calls, and every rule called has a non-empty, connected LHS. Each match of
+ * such a rule lies within one connected component of the host graph, and its
+ * application does not join components. A loop therefore acts on each
+ * component independently, and the program can be run on each component
+ * separately (compiler flag -C). Other commands are not component-local: a
+ * single rule call, for instance, applies the rule in one component only. */
+bool isComponentLocal(List *declarations);
+
 /* The static analysis for GP 2 programs annotates the AST nodes of conditional
  * branches and loops by setting some flags according to an analysis of a particular
  * subprogram. Two flags are modified by this analysis.
@@ -527,6 +527,14 @@ GPRule *newASTRule(YYLTYPE location, string name, List *variables,
     rule->predicate_count = 0;
     rule->empty_lhs = false;
     rule->is_predicate = false;
+    rule->looped = false;
+    rule->in_shared_set = false;
+    rule->loop_body = false;
+    rule->batched = false;
+    rule->first_mark = NONE;
+    rule->first_indegree = 0;
+    rule->first_outdegree = 0;
+    rule->first_degree = 0;
     return rule;
 }    
 
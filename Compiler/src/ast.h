@@ -284,6 +284,21 @@ typedef struct GPRule {
    int predicate_count;
    bool empty_lhs;
    bool is_predicate;
+   /* Set by annotateRuleCalls if the rule is called inside a loop body. */
+   bool looped;
+   /* Set by annotateRuleCalls if the rule is called in a shared rule set
+    * (see isSharedRuleSet in analysis.h). */
+   bool in_shared_set;
+   /* Set by annotateRuleCalls if the rule call is the body of a loop. */
+   bool loop_body;
+   /* Set during rule code generation if the loops whose body is a call of the
+    * rule apply batches of matches (compiler flag -b). */
+   bool batched;
+   /* Set during rule code generation if the rule is called in a shared rule
+    * set: the mark and the degrees of the LHS node that starts its searchplan.
+    * first_degree counts the node's bidirectional edges as well. */
+   MarkType first_mark;
+   int first_indegree, first_outdegree, first_degree;
 } GPRule;
 
 GPRule *newASTRule(YYLTYPE location, string name, List *variables, 
@@ -20,25 +20,26 @@
  * the condition always evaluates to true, so that the condition isn't erroneously
  * falsified when one of these variables is modified by the evaluation of a 
  * predicate. */
-void generateConditionVariables(Condition *condition)
+void generateConditionVariables(Condition *condition, bool thread_local)
 {
    static int bool_count = 0;
+   string storage = thread_local ? "__thread " : "";
    switch(condition->type)
    {
       /* Booleans representing positive predicates are initialised with true. */
       case 'e':
-           PTF("bool b%d = true;\n", bool_count++);
+           PTF("%sbool b%d = true;\n", storage, bool_count++);
            break;
 
       /* Booleans representing 'not' predicates are initialised with false. */
       case 'n':
-           PTF("bool b%d = false;\n", bool_count++);
+           PTF("%sbool b%d = false;\n", storage, bool_count++);
            break;
 
       case 'a':
       case 'o':
-           generateConditionVariables(condition->left_condition);
-           generateConditionVariables(condition->right_condition);
+           generateConditionVariables(condition->left_condition, thread_local);
+           generateConditionVariables(condition->right_condition, thread_local);
            break;
 
       default:
@@ -227,8 +228,11 @@ static void generatePredicateCode(Rule *rule, Predicate *predicate)
            int target = predicate->edge_pred.target;    
            PTFI("Node *source = getNode(host, n%d);\n", 3, source);
            PTFI("bool edge_found = false;\n", 3);
-           PTFI("int counter;\n", 3);
-           PTFI("for(counter = 0; counter < source->out_edges.size + 2; counter++)\n", 3);
+           PTFI("/* The scan is skipped if the adjacency bitmap shows that there is\n", 3);
+           PTFI(" * no edge between the nodes. */\n", 3);
+           PTFI("int counter, edges = source->out_edges.size + 2;\n", 3);
+           PTFI("if(!mayBeAdjacent(host, n%d, n%d)) edges = 0;\n", 3, source, target);
+           PTFI("for(counter = 0; counter < edges; counter++)\n", 3);
            PTFI("{\n", 3);
            PTFI("Edge *edge = getNthOutEdge(host, source, counter);\n", 6);
            PTFI("if(edge != NULL && edge->target == n%d)\n", 6, target);
@@ -350,3 +354,29 @@ void generatePredicateEvaluators(Rule *rule, Condition *condition)
    }
 }
 
+void generateConditionReset(Condition *condition, int indent)
+{
+   switch(condition->type)
+   {
+      case 'e':
+           if(condition->predicate->negated) 
+              PTFI("b%d = false;\n", indent, condition->predicate->bool_id);
+           else PTFI("b%d = true;\n", indent, condition->predicate->bool_id);
+           break;
+
+      case 'n':
+           generateConditionReset(condition->neg_condition, indent);
+           break;
+
+      case 'a':
+      case 'o':
+           generateConditionReset(condition->left_condition, indent);
+           generateConditionReset(condition->right_condition, indent);
+           break;
+
+      default:
+           print_to_log("Error (generateConditionReset): Unexpected condition "
+                        "type '%c'.\n", condition->type);
+           break;
+   }
+}
@@ -72,10 +72,18 @@
  * }
  *
  * The function returns false if the values requires for the condition (node degrees
- * and variable values) have not yet been instantiated by rule matching. */
+ * and variable values) have not yet been instantiated by rule matching.
+ *
+ * If thread_local is set, the variables are declared __thread so that the
+ * threads of a parallel search (compiler flag -T) evaluate the condition
+ * independently. */
 
-void generateConditionVariables(Condition *condition);
+void generateConditionVariables(Condition *condition, bool thread_local);
 void generateConditionEvaluator(Condition *condition, bool nested);
 void generatePredicateEvaluators(Rule *rule, Condition *condition);
 
+/* Prints assignments that restore the initial values of the condition's
+ * boolean variables, for use in the body of a matching function. */
+void generateConditionReset(Condition *condition, int indent);
+
 #endif /* INC_GEN_CONDITION_H */
@@ -50,12 +50,24 @@ typedef enum {MAIN_BODY, IF_BODY, TRY_BODY, LOOP_BODY} ContextType;
  *                 Its value is assigned the value of the global restore_point_count
  *                 if a command's rrecord_changes flag is set. The count is incremented
  *                 when assigned to ensure unique restore point names at runtime.
- * indent - For formatting the printed C code. */
+ * indent - For formatting the printed C code.
+ * keep_match - Set for the rule call forming the condition of a branch statement
+ *              whose then branch reuses its match (see getReusableMatch). The
+ *              match is not discarded after the condition.
+ * matched_rule - If not NULL, the match of this rule found by a branch condition
+ *                is still valid. A call of the rule as the first command is
+ *                generated without matching.
+ * speculate - Set if try statements may run their else branch speculatively
+ *             (compiler flag -S). Unset in loops and in the condition of a
+ *             speculative try statement. */
  typedef struct CommandData {
    ContextType context;
    bool record_changes;
    int restore_point;
    int indent;
+   bool keep_match;
+   GPRule *matched_rule;
+   bool speculate;
 } CommandData;
 
 /* If the host graph contains fewer than MIN_HOST_NODE_SIZE nodes, the host
@@ -83,11 +95,38 @@ static int getArraySize(int number_of_items, int minimum_size)
 static void generateMorphismCode(List *declarations, char type, bool first_call);
 static void generateProgramCode(GPCommand *command, CommandData data);
 static void generateRuleCall(string rule_name, bool empty_lhs, bool predicate,
-                             bool last_rule, CommandData data);
+                             bool last_rule, int set_index, CommandData data);
+static void generateMatchedRuleCall(string rule_name, bool predicate, CommandData data);
+static void generateRuleTests(List *rules, bool *group, int set_id, bool shared,
+                              bool reordered, int indent);
+static void generateMarkGroups(List *rules, int set_id, bool reordered, int indent);
+static void generateSharedScan(List *rules, int set_id, bool reordered, int indent);
+static void generateRuleSetMatch(List *rules, bool shared, bool reordered, int indent);
 static void generateBranchStatement(GPCommand *command, CommandData data);
 static void generateLoopStatement(GPCommand *command, CommandData data);
+static void generateBatchedLoop(GPRule *rule, CommandData data);
 static void generateFailureCode(string rule_name, CommandData data);
 
+/* Finds the main declaration and generates code from its command sequence. */
+static void generateMainBody(List *declarations)
+{
+   List *iterator = declarations;
+   while(iterator != NULL)
+   {
+      GPDeclaration *decl = iterator->declaration;
+      if(decl->type == MAIN_DECLARATION)
+      {
+         CommandData initialData = {MAIN_BODY, false, -1, 3, false, NULL,
+                                    speculative_branches}; 
+         generateProgramCode(decl->main_program, initialData);
+         /* A speculative process may print its output only once it is known
+          * to run in place of its parent. */
+         if(speculative_branches) PTFI("confirmSpeculation();\n", 3);
+      }
+      iterator = iterator->next;
+   }
+}
+
 void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
                          string host_file, string output_dir, string program_name)
 {
@@ -101,12 +140,27 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
      exit(1);
    }
 
+   /* Match stores, locality seeds and the trace refer to the host graph that
+    * exists when they are created, so they cannot follow the graphs of batch
+    * mode. A speculative process continues the rest of the batch in place of
+    * its parent, which would wait for it, so each failed condition would leave
+    * a process behind. */
+   bool batch_mode = !incremental_matching && !locality_matching && !program_tracing &&
+                     !speculative_branches;
+
    PTF("#include <time.h>\n");
+   if(batch_mode) PTF("#include \"batch.h\"\n");
+   if(shared_rule_sets) PTF("#include \"candidates.h\"\n");
    PTF("#include \"debug.h\"\n");
    PTF("#include \"graph.h\"\n");
+   if(component_workers > 0) PTF("#include \"components.h\"\n");
+   if(bitmap_budget >= 0) PTF("#include \"adjacency.h\"\n");
    PTF("#include \"graphStacks.h\"\n");
    PTF("#include \"hostParser.h\"\n");
+   if(incremental_matching) PTF("#include \"matchStore.h\"\n");
    PTF("#include \"morphism.h\"\n\n");
+   if(match_threads > 1 || batch_matching) PTF("#include \"parallel.h\"\n");
+   if(speculative_branches) PTF("#include \"speculation.h\"\n");
    PTF("#include \"tracing.h\"\n\n");
 
    /* Declare the global morphism variables for each rule. */
@@ -119,9 +173,12 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
    PTF("{\n");
    PTF("   freeGraph(host);\n");
    #ifdef LIST_HASHING
+      if(match_threads > 1) PTF("   printListStoreCounters(log_file);\n");
       PTF("   freeHostListStore();\n");
    #endif
    PTF("   freeMorphisms();\n");
+   if(incremental_matching) PTF("   freeMatchStores();\n");
+   if(batch_matching) PTF("   freeMatchBatches();\n");
    if(graph_copying) PTF("   freeGraphStack();\n");
    else PTF("   freeGraphChangeStack();\n");
    if (program_tracing) { PTF("   finishTraceFile();\n"); }
@@ -143,41 +200,61 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
       PTF("}\n\n");
       return;
    }
-   PTFI("yyin = fopen(\"%s\", \"r\");\n", 3, host_file);
-   PTFI("if(yyin == NULL)\n", 3);
+   PTFI("FILE *host_file = fopen(\"%s\", \"r\");\n", 3, host_file);
+   PTFI("if(host_file == NULL)\n", 3);
    PTFI("{\n", 3);
    PTFI("perror(\"%s\");\n", 6, host_file);
    PTFI("return NULL;\n", 6);
-   PTFI("}\n\n", 3);
+   PTFI("}\n", 3);
    int host_node_size = getArraySize(host_nodes, MIN_HOST_NODE_SIZE);
    int host_edge_size = getArraySize(host_edges, MIN_HOST_EDGE_SIZE);
-   PTFI("host = newGraph(%d, %d);\n", 3, host_node_size, host_edge_size);
-   PTFI("node_map = calloc(%d, sizeof(int));\n", 3, host_node_size);
-   PTFI("if(node_map == NULL)\n", 3);
-   PTFI("{\n", 3);
-   PTFI("freeGraph(host);\n", 6);
-   PTFI("return NULL;\n", 6);
-   PTFI("}\n", 3);
-   PTFI("/* The parser populates the host graph using node_map to add edges with\n", 3);
-   PTFI(" * the correct source and target indices. */\n", 3);
-   PTFI("int result = yyparse();\n", 3);
-   PTFI("free(node_map);\n", 3);
-   PTFI("fclose(yyin);\n", 3);
-   PTFI("if(result == 0) return host;\n", 3);
-   PTFI("else\n", 3);
-   PTFI("{\n", 3);
-   PTFI("freeGraph(host);\n", 6);
-   PTFI("return NULL;\n", 6);
-   PTFI("}\n", 3);
+   PTFI("Graph *graph = parseHostGraph(host_file, %d, %d);\n", 3, host_node_size,
+        host_edge_size);
+   PTFI("fclose(host_file);\n", 3);
+   PTFI("return graph;\n", 3);
    PTF("}\n\n");
    
    PTF("bool success = true;\n\n");
 
+   /* Component-local programs are run on each connected component of the host
+    * graph by a function passed to runOnComponents (see lib/components.h). */
+   if(component_workers > 0)
+   {
+      PTF("static Graph *runComponent(Graph *component)\n");
+      PTF("{\n");
+      PTFI("host = component;\n", 3);
+      generateMainBody(declarations);
+      PTFI("return host;\n", 3);
+      PTF("}\n\n");
+   }
+
+   /* The program is run by a function so that batch mode (see lib/batch.h) can
+    * run it on each of its host graphs. */
+   PTF("static bool runProgram(FILE *output_file)\n");
+   PTF("{\n");
+   PTFI("success = true;\n", 3);
+   if(component_workers > 0)
+   {
+      PTFI("Graph *input = host;\n", 3);
+      PTFI("runOnComponents(input, runComponent, %d, output_file);\n", 3, component_workers);
+      PTFI("host = input;\n", 3);
+   }
+   else
+   {
+      generateMainBody(declarations);
+      PTFI("printGraph(host, output_file);\n", 3);
+   }
+   PTFI("return true;\n", 3);
+   PTF("}\n\n");
+
    /* Open the runtime's main function and set up the execution environment. */
-   PTF("int main(void)\n");
+   PTF("int main(int argc, char **argv)\n");
    PTF("{\n");
    PTFI("srand(time(NULL));\n", 3);
    PTFI("openLogFile(\"gp2.log\");\n", 3);
+   if(bitmap_budget >= 0)
+      PTFI("adjacency_bitmap_budget = %dL * 1024 * 1024;\n", 3, bitmap_budget);
+   if(match_threads > 1) PTFI("worker_threads = %d;\n", 3, match_threads);
    #if defined GRAPH_TRACING || defined RULE_TRACING || defined BACKTRACK_TRACING
       PTFI("openTraceFile(\"gp2.trace\");\n", 3);
    #endif
@@ -189,6 +266,26 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
       PTFI("beginTraceFile(\"gp2.gptrace\", \"%s\", \"%s\");\n", 3, program_name, host_file);
    }
 
+   /* Print the calls to allocate memory for each morphism. */
+   generateMorphismCode(declarations, 'm', true);
+
+   /* Batch mode is started by passing arguments to the runtime. */
+   PTFI("if(argc > 1)\n", 3);
+   PTFI("{\n", 3);
+   if(batch_mode)
+   {
+      PTFI("int status = runBatch(argc, argv, runProgram);\n", 6);
+      PTFI("garbageCollect();\n", 6);
+      PTFI("return status;\n", 6);
+   }
+   else
+   {
+      PTFI("fprintf(stderr, \"Batch mode is not available with incremental matching, \"\n", 6);
+      PTFI("        \"locality-seeded matching, program tracing or speculation.\\n\");\n", 6);
+      PTFI("return 1;\n", 6);
+   }
+   PTFI("}\n\n", 3);
+
    PTFI("host = buildHostGraph();\n", 3);
    PTFI("if(host == NULL)\n", 3);
    PTFI("{\n", 3);
@@ -207,24 +304,10 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
       PTFI("print_trace(\"Start Graph: \\n\");\n", 3);
       PTFI("printGraph(host, trace_file);\n\n", 3);
    #endif
- 
-   /* Print the calls to allocate memory for each morphism. */
-   generateMorphismCode(declarations, 'm', true);
 
-   /* Find the main declaration and generate code from its command sequence. */
-   List *iterator = declarations;
-   while(iterator != NULL)
-   {
-      GPDeclaration *decl = iterator->declaration;
-      if(decl->type == MAIN_DECLARATION)
-      {
-         CommandData initialData = {MAIN_BODY, false, -1, 3}; 
-         generateProgramCode(decl->main_program, initialData);
-      }
-      iterator = iterator->next;
-   }
-   PTF("   printGraph(host, output_file);\n");
-   PTF("   printf(\"Output graph saved to file gp2.output\\n\");\n");
+   PTFI("if(runProgram(output_file))\n", 3);
+   PTFI("printf(\"Output graph saved to file gp2.output\\n\");\n", 6);
+   PTFI("else printf(\"Output information saved to file gp2.output\\n\");\n", 3);
    PTF("   garbageCollect();\n");
    //PTF("   printf(\"Graph changes recorded: %%d\\n\", graph_change_count);\n");
    PTF("   fclose(output_file);\n");
@@ -296,6 +379,13 @@ static void generateMorphismCode(List *declarations, char type, bool first_call)
 
 static void generateProgramCode(GPCommand *command, CommandData data)
 {
+   /* A match kept by a branch condition is only passed to the first command of a
+    * sequence, and only used if that command is a rule call. */
+   if(command->type != COMMAND_SEQUENCE && command->type != RULE_CALL)
+   {
+      data.keep_match = false;
+      data.matched_rule = NULL;
+   }
    switch(command->type)
    {
       case COMMAND_SEQUENCE:
@@ -313,6 +403,7 @@ static void generateProgramCode(GPCommand *command, CommandData data)
                * generateProgramCode. */
               if(stop_recording) new_data.record_changes = false;
               generateProgramCode(command, new_data);
+              new_data.matched_rule = NULL;
               if(data.context == LOOP_BODY && commands->next != NULL)
               {
                  PTFI("if(!success)\n", data.indent);
@@ -327,8 +418,14 @@ static void generateProgramCode(GPCommand *command, CommandData data)
       }
       case RULE_CALL:
            PTFI("/* Rule Call */\n", data.indent);
+           if(data.matched_rule != NULL && data.matched_rule == command->rule_call.rule)
+           {
+              generateMatchedRuleCall(command->rule_call.rule_name,
+                                      command->rule_call.rule->is_predicate, data);
+              break;
+           }
            generateRuleCall(command->rule_call.rule_name, command->rule_call.rule->empty_lhs,
-                            command->rule_call.rule->is_predicate, true, data);
+                            command->rule_call.rule->is_predicate, true, -1, data);
            break;
 
       case RULE_SET_CALL:
@@ -342,14 +439,21 @@ static void generateProgramCode(GPCommand *command, CommandData data)
            PTFI("{\n", data.indent);
            CommandData new_data = data;
            new_data.indent = data.indent + 3;
+           bool shared = isSharedRuleSet(command->rule_set);
+           bool reordered = isReorderedRuleSet(command->rule_set);
+           if(shared || reordered)
+              generateRuleSetMatch(command->rule_set, shared, reordered, new_data.indent);
            List *rules = command->rule_set;
+           int set_index = 0;
            while(rules != NULL)
            {  
               string rule_name = rules->rule_call.rule_name;
               bool empty_lhs = rules->rule_call.rule->empty_lhs;
               bool predicate = rules->rule_call.rule->is_predicate;
-              generateRuleCall(rule_name, empty_lhs, predicate, rules->next == NULL, new_data);
+              generateRuleCall(rule_name, empty_lhs, predicate, rules->next == NULL,
+                               shared || reordered ? set_index : -1, new_data);
               rules = rules->next;
+              set_index++;
            }
            PTFI("} while(false);\n", data.indent);
            if (program_tracing) { PTFI("traceEndContext(/* ruleset */);\n", data.indent); }
@@ -465,9 +569,12 @@ static void generateProgramCode(GPCommand *command, CommandData data)
  * predicate: If this flag is set, code to apply the rule is not generated.
  * last_rule: Set if this is the last rule in a rule set call. Controls the
  *            generation of failure code. 
+ * set_index: The position of the rule in a shared rule set, or -1. If not -1,
+ *            the match found by generateRuleSetMatch is used instead of
+ *            calling the rule matching function.
  * data:      CommandData passed from the calling command. */
 static void generateRuleCall(string rule_name, bool empty_lhs, bool predicate,
-                             bool last_rule, CommandData data)
+                             bool last_rule, int set_index, CommandData data)
 {
    /* If program tracing is enabled, start a new rule context here. Since break
    statements are generated at various points, the context has to be ended in
@@ -503,7 +610,8 @@ static void generateRuleCall(string rule_name, bool empty_lhs, bool predicate,
       #ifdef RULE_TRACING
          PTFI("print_trace(\"Matching %s...\\n\");\n", data.indent, rule_name);
       #endif
-      PTFI("if(match%s(M_%s))\n", data.indent, rule_name, rule_name);
+      if(set_index >= 0) PTFI("if(rule_set_match == %d)\n", data.indent, set_index);
+      else PTFI("if(match%s(M_%s))\n", data.indent, rule_name, rule_name);
       PTFI("{\n", data.indent);
       #ifdef RULE_TRACING
          PTFI("print_trace(\"Matched %s.\\n\\n\");\n", data.indent + 3, rule_name);
@@ -526,7 +634,9 @@ static void generateRuleCall(string rule_name, bool empty_lhs, bool predicate,
                PTFI("printGraph(host, trace_file);\n\n", data.indent + 3);
             #endif
          }
-         else PTFI("initialiseMorphism(M_%s, host);\n", data.indent + 3, rule_name);
+         /* If the then branch reuses the match, it is kept in the morphism. */
+         else if(!data.keep_match)
+            PTFI("initialiseMorphism(M_%s, host);\n", data.indent + 3, rule_name);
       }
       if (program_tracing) { PTFI("traceEndContext(/* rule */);\n", data.indent + 3); }
       PTFI("success = true;\n", data.indent + 3);
@@ -563,6 +673,344 @@ static void generateRuleCall(string rule_name, bool empty_lhs, bool predicate,
    }
 }
 
+/* Generates a call of a rule whose match was found by the condition of the
+ * enclosing branch statement (see getReusableMatch). The match is in the rule's
+ * morphism, unless the rule is a predicate, in which case there is nothing to
+ * apply. The rule application code follows generateRuleCall. */
+static void generateMatchedRuleCall(string rule_name, bool predicate, CommandData data)
+{
+   PTFI("/* The match found by the condition is reused. */\n", data.indent);
+   #ifdef RULE_TRACING
+      PTFI("print_trace(\"Matched %s. (reused match)\\n\\n\");\n", data.indent, rule_name);
+   #endif
+   if(!predicate)
+   {
+      if(data.context != IF_BODY || data.restore_point >= 0)
+      {
+         if(data.record_changes && !graph_copying)
+              PTFI("apply%s(M_%s, true);\n", data.indent, rule_name, rule_name);
+         else PTFI("apply%s(M_%s, false);\n", data.indent, rule_name, rule_name);
+         #ifdef GRAPH_TRACING
+            PTFI("print_trace(\"Graph after applying rule %s:\\n\");\n",
+                 data.indent, rule_name);
+            PTFI("printGraph(host, trace_file);\n\n", data.indent);
+         #endif
+      }
+      else PTFI("initialiseMorphism(M_%s, host);\n", data.indent, rule_name);
+   }
+   PTFI("success = true;\n", data.indent);
+}
+
+/* Emits the tests of the rules of a rule set whose entry in the group array is
+ * set, or of all rules if group is NULL. The tests leave the index of the first
+ * rule that matches in rule_set_match. The rules of a shared set are matched
+ * from host_node, and those of a reordered set are tried in the order held by
+ * the array rule_set_order<set_id>. */
+static void generateRuleTests(List *rules, bool *group, int set_id, bool shared,
+                              bool reordered, int indent)
+{
+   if(reordered)
+   {
+      PTFI("for(attempt = 0; attempt < %d; attempt++)\n", indent, getASTListLength(rules));
+      PTFI("{\n", indent);
+      indent += 3;
+   }
+   int index, tests = 0;
+   List *iterator = rules;
+   for(index = 0; iterator != NULL; index++)
+   {
+      string rule_name = iterator->rule_call.rule_name;
+      iterator = iterator->next;
+      if(group != NULL && !group[index]) continue;
+      PTFI("%sif(", indent, tests++ == 0 ? "" : "else ");
+      if(reordered) PTF("rule_set_order%d[attempt] == %d && ", set_id, index);
+      if(shared) PTF("may_match[%d] && match%sFromNode(M_%s, host_node)", index, rule_name,
+                     rule_name);
+      else PTF("match%s(M_%s)", rule_name, rule_name);
+      PTF(") rule_set_match = %d;\n", index);
+   }
+   if(reordered)
+   {
+      PTFI("if(rule_set_match >= 0) break;\n", indent);
+      PTFI("}\n", indent - 3);
+   }
+}
+
+/* Emits the tests of the rules of a shared rule set at the candidate host_node.
+ * A rule can only match at host nodes whose mark is accepted by the first node
+ * of its searchplan. If the rules do not all accept the same marks, they are
+ * grouped by the marks they accept: the mark of the host node is tested once,
+ * and only the rules of its group are tried. Marks accepted by the same rules
+ * share a group. */
+static void generateMarkGroups(List *rules, int set_id, bool reordered, int indent)
+{
+   int rule_count = getASTListLength(rules);
+   bool accepts[HOST_MARKS][rule_count];
+   bool grouped[HOST_MARKS];
+   int mark, other, index;
+   List *iterator = rules;
+   for(index = 0; iterator != NULL; index++)
+   {
+      MarkType first_mark = iterator->rule_call.rule->first_mark;
+      for(mark = 0; mark < HOST_MARKS; mark++)
+         accepts[mark][index] = first_mark == ANY ? mark != NONE : mark == first_mark;
+      iterator = iterator->next;
+   }
+   bool single_group = true;
+   for(mark = 0; mark < HOST_MARKS; mark++)
+   {
+      grouped[mark] = true;
+      for(index = 0; index < rule_count; index++)
+      {
+         if(accepts[mark][index]) grouped[mark] = false;
+         if(accepts[mark][index] != accepts[mark][0]) single_group = false;
+      }
+   }
+   if(single_group)
+   {
+      generateRuleTests(rules, NULL, set_id, true, reordered, indent);
+      return;
+   }
+   /* Marks accepted by no rule fall to the default case. */
+   PTFI("switch(host_node->label.mark)\n", indent);
+   PTFI("{\n", indent);
+   for(mark = 0; mark < HOST_MARKS; mark++)
+   {
+      if(grouped[mark]) continue;
+      for(other = mark; other < HOST_MARKS; other++)
+      {
+         if(grouped[other] || memcmp(accepts[other], accepts[mark], sizeof(accepts[mark])))
+            continue;
+         PTFI("case %d:\n", indent + 3, other);
+         grouped[other] = true;
+      }
+      generateRuleTests(rules, accepts[mark], set_id, true, reordered, indent + 6);
+      PTFI("break;\n", indent + 6);
+   }
+   PTFI("default:\n", indent + 3);
+   PTFI("break;\n", indent + 6);
+   PTFI("}\n", indent);
+}
+
+/* Emits the scan of the host graph for the first rule of a shared rule set that
+ * matches. The candidate host nodes are the root nodes if the rules have rooted
+ * LHSs, and otherwise the nodes that pass the mark and degree tests of
+ * filterNodes (see lib/candidates.h) with the weakest bounds required by the
+ * first LHS nodes of the rules. */
+static void generateSharedScan(List *rules, int set_id, bool reordered, int indent)
+{
+   if(hasRootedLHS(rules->rule_call.rule))
+   {
+      PTFI("RootNodes *nodes;\n", indent);
+      PTFI("for(nodes = getRootNodeList(host); nodes != NULL; nodes = nodes->next)\n",
+           indent);
+      PTFI("{\n", indent);
+      PTFI("Node *host_node = getNode(host, nodes->index);\n", indent + 3);
+      PTFI("if(host_node == NULL) continue;\n", indent + 3);
+   }
+   else
+   {
+      MarkType mark = rules->rule_call.rule->first_mark;
+      int indegree = rules->rule_call.rule->first_indegree;
+      int outdegree = rules->rule_call.rule->first_outdegree;
+      int degree = rules->rule_call.rule->first_degree;
+      bool same_mark = true, marked = true;
+      List *iterator;
+      for(iterator = rules; iterator != NULL; iterator = iterator->next)
+      {
+         GPRule *rule = iterator->rule_call.rule;
+         if(rule->first_mark != mark) same_mark = false;
+         if(rule->first_mark == NONE) marked = false;
+         if(rule->first_indegree < indegree) indegree = rule->first_indegree;
+         if(rule->first_outdegree < outdegree) outdegree = rule->first_outdegree;
+         if(rule->first_degree < degree) degree = rule->first_degree;
+      }
+      /* Without a common mark, the filter passes every marked node if no
+       * rule needs an unmarked one, and every node otherwise. */
+      char filter_mark[16];
+      if(same_mark) sprintf(filter_mark, "%d", mark);
+      else if(marked) sprintf(filter_mark, "%d", ANY);
+      else strcpy(filter_mark, "EVERY_MARK");
+      PTFI("int candidates[FILTER_BLOCK];\n", indent);
+      PTFI("int block, candidate;\n", indent);
+      PTFI("for(block = 0; block < host->nodes.size && rule_set_match < 0; "
+           "block += FILTER_BLOCK)\n", indent);
+      PTFI("{\n", indent);
+      PTFI("int count = filterNodes(host, block, %s, %d, %d, %d, candidates);\n",
+           indent + 3, filter_mark, indegree, outdegree, degree);
+      PTFI("for(candidate = 0; candidate < count; candidate++)\n", indent + 3);
+      indent += 3;
+      PTFI("{\n", indent);
+      PTFI("Node *host_node = getNode(host, candidates[candidate]);\n", indent + 3);
+   }
+   generateMarkGroups(rules, set_id, reordered, indent + 3);
+   PTFI("if(rule_set_match >= 0) break;\n", indent + 3);
+   PTFI("}\n", indent);
+   if(!hasRootedLHS(rules->rule_call.rule))
+   {
+      indent -= 3;
+      PTFI("}\n", indent);
+   }
+}
+
+/* Generates the code that finds the rule of a rule set to apply, leaving its
+ * index in rule_set_match and its match in the rule's morphism.
+ *
+ * If the set is shared, the host graph is scanned once (see generateSharedScan).
+ * The rules ruled out by constant-time tests are left out of the scan, which is
+ * skipped if no rule remains. If the scan finds no match, the failure of the
+ * rules it searched for is recorded, so that they are left out of later scans
+ * until the host graph changes in a way that may affect them. At each candidate, the rules whose first
+ * LHS node accepts the candidate's mark are tried in order (see
+ * generateMarkGroups), and the scan stops at the first match.
+ *
+ * If the set is reordered, the rules are tried in the order held by a static
+ * array of the generated main function, which is updated after each match
+ * according to the rule set policy. The MATCH_COUNT policy also keeps a static
+ * array with the number of matches of each rule. */
+static void generateRuleSetMatch(List *rules, bool shared, bool reordered, int indent)
+{
+   static int rule_set_count = 0;
+   int set_id = rule_set_count++;
+   int rule_count = getASTListLength(rules);
+   int index;
+   if(shared) PTFI("/* Scan the host graph once for all rules in the set. */\n", indent);
+   if(reordered)
+   {
+      PTFI("/* The order in which the rules are tried, updated after each match. */\n",
+           indent);
+      PTFI("static int rule_set_order%d[%d] = {", indent, set_id, rule_count);
+      for(index = 0; index < rule_count; index++) PTF(index == 0 ? "%d" : ", %d", index);
+      PTF("};\n");
+      if(rule_set_policy == MATCH_COUNT)
+      {
+         PTFI("static int rule_set_matches%d[%d] = {", indent, set_id, rule_count);
+         for(index = 0; index < rule_count; index++) PTF(index == 0 ? "0" : ", 0");
+         PTF("};\n");
+      }
+      PTFI("int attempt = 0;\n", indent);
+   }
+   PTFI("int rule_set_match = -1;\n", indent);
+   if(shared)
+   {
+      PTFI("/* The rules not ruled out by the constant-time tests of their matching "
+           "functions. */\n", indent);
+      PTFI("bool may_match[%d] = {", indent, rule_count);
+      List *iterator;
+      for(iterator = rules; iterator != NULL; iterator = iterator->next)
+         PTF("%smayMatch%s()", iterator == rules ? "" : ", ", iterator->rule_call.rule_name);
+      PTF("};\n");
+      PTFI("if(", indent);
+      for(index = 0; index < rule_count; index++)
+         PTF(index == 0 ? "may_match[%d]" : " || may_match[%d]", index);
+      PTF(")\n");
+      PTFI("{\n", indent);
+      generateSharedScan(rules, set_id, reordered, indent + 3);
+      if(!graph_copying)
+      {
+         /* The scan searched the whole host graph for each rule it tried. */
+         PTFI("if(rule_set_match < 0)\n", indent + 3);
+         PTFI("{\n", indent + 3);
+         for(iterator = rules, index = 0; iterator != NULL; iterator = iterator->next, index++)
+            PTFI("if(may_match[%d]) failed%s();\n", indent + 6, index,
+                 iterator->rule_call.rule_name);
+         PTFI("}\n", indent + 3);
+      }
+      PTFI("}\n", indent);
+   }
+   else generateRuleTests(rules, NULL, set_id, false, reordered, indent);
+   if(reordered)
+   {
+      /* attempt is the position of the matched rule in the order array. */
+      PTFI("if(rule_set_match >= 0)\n", indent);
+      PTFI("{\n", indent);
+      if(rule_set_policy == MOVE_TO_FRONT)
+      {
+         PTFI("/* Move the matched rule to the front. */\n", indent + 3);
+         PTFI("for(; attempt > 0; attempt--)\n", indent + 3);
+      }
+      else
+      {
+         PTFI("/* Move the matched rule in front of the rules with fewer matches. */\n",
+              indent + 3);
+         PTFI("rule_set_matches%d[rule_set_match]++;\n", indent + 3, set_id);
+         PTFI("for(; attempt > 0 && rule_set_matches%d[rule_set_order%d[attempt - 1]] <\n",
+              indent + 3, set_id, set_id);
+         PTFI("                    rule_set_matches%d[rule_set_match]; attempt--)\n",
+              indent + 3, set_id);
+      }
+      PTFI("rule_set_order%d[attempt] = rule_set_order%d[attempt - 1];\n",
+           indent + 6, set_id, set_id);
+      PTFI("rule_set_order%d[attempt] = rule_set_match;\n", indent + 3, set_id);
+      PTFI("}\n", indent);
+   }
+   PTF("\n");
+}
+
+/* Returns the command if it is not a sequence, the only command of a sequence
+ * of one command, or NULL. */
+static GPCommand *getSingleCommand(GPCommand *command)
+{
+   while(command->type == COMMAND_SEQUENCE)
+   {
+      if(command->commands == NULL || command->commands->next != NULL) return NULL;
+      command = command->commands->command;
+   }
+   return command;
+}
+
+/* Returns the first simple command of the command, or NULL. */
+static GPCommand *getFirstCommand(GPCommand *command)
+{
+   while(command->type == COMMAND_SEQUENCE)
+   {
+      if(command->commands == NULL) return NULL;
+      command = command->commands->command;
+   }
+   return command;
+}
+
+/* Returns the rule called by the condition of the branch statement if the then
+ * branch starts with a call of the same rule and the match found by the
+ * condition is still valid at that call. This holds if the condition is a single
+ * call of a rule with a non-empty LHS that does not change the host graph: a
+ * predicate rule, or any rule in the condition of an if statement that does not
+ * record graph changes, since the rule is not applied there. The then branch
+ * then applies the rule without searching the host graph again.
+ * Returns NULL otherwise, and if program tracing is enabled, because the trace
+ * records each rule match. */
+static GPRule *getReusableMatch(GPCommand *command)
+{
+   if(program_tracing) return NULL;
+   GPCommand *condition = getSingleCommand(command->cond_branch.condition);
+   if(condition == NULL || condition->type != RULE_CALL) return NULL;
+   GPRule *rule = condition->rule_call.rule;
+   if(rule->empty_lhs) return NULL;
+   if(!rule->is_predicate &&
+      (command->type != IF_STATEMENT || command->cond_branch.record_changes)) return NULL;
+   GPCommand *first = getFirstCommand(command->cond_branch.then_command);
+   if(first == NULL || first->type != RULE_CALL || first->rule_call.rule != rule)
+      return NULL;
+   return rule;
+}
+
+/* Returns true if the else branch of the branch statement is run speculatively
+ * while its condition is evaluated (see lib/speculation.h). This requires a try
+ * statement in a context that allows speculation whose condition does more than
+ * a single rule call and whose else branch does more than skip; otherwise the
+ * fork would cost more than it saves. */
+static bool isSpeculative(GPCommand *command, CommandData data)
+{
+   if(!data.speculate || command->type != TRY_STATEMENT) return false;
+   GPCommand *condition = getSingleCommand(command->cond_branch.condition);
+   if(condition != NULL &&
+      (condition->type == RULE_CALL || condition->type == RULE_SET_CALL ||
+       condition->type == SKIP_STATEMENT || condition->type == FAIL_STATEMENT ||
+       condition->type == BREAK_STATEMENT)) return false;
+   GPCommand *else_command = getSingleCommand(command->cond_branch.else_command);
+   return else_command == NULL || else_command->type != SKIP_STATEMENT;
+}
+
 /* generateBranchStatement passes on the command data passed by the caller to
  * the calls to generate code for the then and else branches.
  * The flags from the GPCommand structure are used onlt to generate code for
@@ -578,6 +1026,14 @@ static void generateBranchStatement(GPCommand *command, CommandData data)
       condition_data.restore_point = restore_point_count++;
    }
    else condition_data.restore_point = -1;
+   GPRule *reused_match = getReusableMatch(command);
+   if(reused_match != NULL) condition_data.keep_match = !reused_match->is_predicate;
+   bool speculative = isSpeculative(command, data);
+   if(speculative)
+   {
+      condition_data.speculate = false;
+      condition_data.indent = data.indent + 6;
+   }
 
    if(condition_data.context == IF_BODY) PTFI("/* If Statement */\n", data.indent);
    else PTFI("/* Try Statement */\n", data.indent);
@@ -606,10 +1062,26 @@ static void generateBranchStatement(GPCommand *command, CommandData data)
       }
    }
    if (program_tracing) { PTFI("traceBeginContext(\"condition\");\n", data.indent); } 
-   PTFI("do\n", data.indent);
-   PTFI("{\n", data.indent);
-   generateProgramCode(command->cond_branch.condition, condition_data);
-   PTFI("} while(false);\n\n", data.indent);
+   if(speculative)
+   {
+      /* The speculative process goes straight to the else branch. */
+      PTFI("if(!beginSpeculation())\n", data.indent);
+      PTFI("{\n", data.indent);
+      PTFI("do\n", data.indent + 3);
+      PTFI("{\n", data.indent + 3);
+      generateProgramCode(command->cond_branch.condition, condition_data);
+      PTFI("} while(false);\n", data.indent + 3);
+      PTFI("endSpeculation(success);\n", data.indent + 3);
+      PTFI("}\n", data.indent);
+      PTFI("else success = false;\n\n", data.indent);
+   }
+   else
+   {
+      PTFI("do\n", data.indent);
+      PTFI("{\n", data.indent);
+      generateProgramCode(command->cond_branch.condition, condition_data);
+      PTFI("} while(false);\n\n", data.indent);
+   }
    if (program_tracing) { PTFI("traceEndContext(/* condition */);\n", data.indent); } 
 
    if(condition_data.context == IF_BODY)
@@ -637,7 +1109,9 @@ static void generateBranchStatement(GPCommand *command, CommandData data)
    PTFI("if(success)\n", data.indent);
    PTFI("{\n", data.indent);
    if (program_tracing) { PTFI("traceBeginContext(\"then\");\n", data.indent + 3); } 
+   new_data.matched_rule = reused_match;
    generateProgramCode(command->cond_branch.then_command, new_data);
+   new_data.matched_rule = NULL;
    if (program_tracing) { PTFI("traceEndContext(/* then */);\n", data.indent + 3); } 
    PTFI("}\n", data.indent);
    PTFI("/* Else Branch */\n", data.indent);
@@ -680,6 +1154,16 @@ void generateLoopStatement(GPCommand *command, CommandData data)
    CommandData loop_data = data;
    loop_data.context = LOOP_BODY;
    loop_data.indent = data.indent + 3;
+   /* A process would be forked in each iteration. */
+   loop_data.speculate = false;
+   GPCommand *body = getSingleCommand(command->loop_stmt.loop_body);
+   if(body != NULL && body->type == RULE_CALL && body->rule_call.rule->batched &&
+      !command->loop_stmt.record_changes)
+   {
+      loop_data.restore_point = -1;
+      generateBatchedLoop(body->rule_call.rule, loop_data);
+      return;
+   }
    if(command->loop_stmt.record_changes)
    {
       loop_data.record_changes = true;
@@ -754,6 +1238,31 @@ void generateLoopStatement(GPCommand *command, CommandData data)
    PTFI("success = true;\n", data.indent);
 }
 
+/* Generates a loop whose body is a call of a batched rule (compiler flag -b).
+ * Each iteration collects a batch of independent matches of the rule (see
+ * lib/parallel.h) and applies them in turn. The loop ends when the batch is
+ * empty, which happens only if the rule does not match. */
+static void generateBatchedLoop(GPRule *rule, CommandData data)
+{
+   int indent = data.indent - 3;
+   PTFI("/* Loop Statement */\n", indent);
+   PTFI("while(success)\n", indent);
+   PTFI("{\n", indent);
+   PTFI("MatchBatch *batch = collect%s();\n", data.indent, rule->name);
+   PTFI("int match;\n", data.indent);
+   PTFI("for(match = 0; match < batch->size; match++)\n", data.indent);
+   PTFI("apply%s(batch->matches[match], %s);\n", data.indent + 3, rule->name,
+        data.record_changes && !graph_copying ? "true" : "false");
+   PTFI("if(batch->size == 0)\n", data.indent);
+   PTFI("{\n", data.indent);
+   CommandData new_data = data;
+   new_data.indent = data.indent + 3;
+   generateFailureCode(rule->name, new_data);
+   PTFI("}\n", data.indent);
+   PTFI("}\n", indent);
+   PTFI("success = true;\n", indent);
+}
+
 /* Generates code to handle failure, which is context-dependent. There are two
  * kinds of failure: 
  * (1) A rule fails to match. The name of the rule is passed as the first 
@@ -762,8 +1271,8 @@ void generateLoopStatement(GPCommand *command, CommandData data)
 
 static void generateFailureCode(string rule_name, CommandData data)
 {
-   /* A failure in the main body ends the execution. Emit code to report the 
-    * failure, garbage collect and return 0. */
+   /* A failure in the main body ends the program. Emit code to report the 
+    * failure and return false from runProgram. */
    if(data.context == MAIN_BODY)
    {
       if (program_tracing && !rule_name) { PTFI("traceFail(true);\n", data.indent); }
@@ -771,16 +1280,13 @@ static void generateFailureCode(string rule_name, CommandData data)
          PTFI("print_trace(\"Program failed. Final graph:\\n\");\n", data.indent);
          PTFI("printGraph(host, trace_file);\n", data.indent);
       #endif
+      if(speculative_branches) PTFI("confirmSpeculation();\n", data.indent);
       if(rule_name != NULL)
          PTFI("fprintf(output_file, \"No output graph: rule %s not applicable.\\n\");\n",
               data.indent, rule_name);
       else PTFI("fprintf(output_file, \"No output graph: Fail statement invoked\\n\");\n",
                 data.indent);
-      PTFI("printf(\"Output information saved to file gp2.output\\n\");\n", data.indent);
-      PTFI("garbageCollect();\n", data.indent);
-      //PTFI("printf(\"Graph changes recorded: %%d\\n\", graph_change_count);\n", data.indent);
-      PTFI("fclose(output_file);\n", data.indent);
-      PTFI("return 0;\n", data.indent);
+      PTFI("return false;\n", data.indent);
    }
    /* In other contexts, set the runtime success flag to false. */
    else {
@@ -28,6 +28,7 @@
 #ifndef INC_GEN_PROGRAM_H
 #define INC_GEN_PROGRAM_H
 
+#include "analysis.h"
 #include "ast.h"
 #include "globals.h"
 
@@ -127,6 +128,44 @@ void generateRuntimeMain(List *declarations, int host_nodes, int host_edges,
  * } while(false);
  *
  *
+ * A shared rule set (compiler flag -m, see isSharedRuleSet in analysis.h) first
+ * runs the constant-time count tests of each rule (see emitCountCheck in
+ * genRule.c) and scans the host graph once for the rules that pass them. At
+ * each candidate node for the first node of the LHSs, the node's mark selects
+ * the rules that can match there, which are tried in turn, and the index of the
+ * first rule that matches is recorded. The rule calls then test this index
+ * instead of calling the matching functions.
+ * A reordered rule set (compiler flag -s) is handled in the same way, except
+ * that the rules are tried in an order kept by the runtime system. In the
+ * example below, the first LHS node of R1 is red and that of R2 is marked any.
+ *
+ * do
+ * {
+ *    int rule_set_match = -1;
+ *    bool may_match[2] = {mayMatchR1(), mayMatchR2()};
+ *    <for each candidate host node, if may_match[0] || may_match[1]>
+ *    {
+ *       switch(host_node->label.mark)
+ *       {
+ *          case 1:
+ *             if(may_match[0] && matchR1FromNode(M_R1, host_node)) rule_set_match = 0;
+ *             else if(may_match[1] && matchR2FromNode(M_R2, host_node))
+ *                rule_set_match = 1;
+ *             break;
+ *          case 2:
+ *          ...
+ *          case 5:
+ *             if(may_match[1] && matchR2FromNode(M_R2, host_node))
+ *                rule_set_match = 1;
+ *             break;
+ *       }
+ *       if(rule_set_match >= 0) break;
+ *    }
+ *    if(rule_set_match == 0)
+ *    ...
+ * } while(false);
+ *
+ *
  * Conditional Branch if/try C then P else Q
  * ===========================================
  * If statements and try statements generate the same code to restore the host
@@ -15,22 +15,64 @@
 
 #include "genRule.h"
 
-static void generateMatchingCode(Rule *rule, bool predicate);
+static void generateMatchingCode(Rule *rule, bool predicate, bool looped, bool shared,
+                                 bool batched);
+static void emitCountCheck(Rule *rule);
+static unsigned int getNodeClasses(Rule *rule);
 static void emitDegreeCheck(RuleNode *left_node, int indent);
+static void emitSignatureCheck(RuleNode *left_node, string fail_code, int indent);
+static void emitNodeFilter(RuleNode *left_node);
 static void emitRootNodeMatcher(Rule *rule, RuleNode *left_node, SearchOp *next_op);
-static void emitNodeMatcher(Rule *rule, RuleNode *left_node, SearchOp *next_op);
+static void emitNodeMatcher(Rule *rule, RuleNode *left_node, bool from_store,
+                            bool tester, SearchOp *next_op);
+static void emitLocalNodeMatcher(RuleNode *left_node, bool from_store);
+static void emitSharedSetMatcher(Rule *rule, bool predicate, bool remember_failure);
+static void emitBatchCollector(Rule *rule);
 static void emitNodeFromEdgeMatcher(Rule *rule, RuleNode *left_node, char type, SearchOp *next_op);
-static void emitNodeMatchResultCode(RuleNode *node, SearchOp *next_op, int indent);
+static void emitSymmetryCheck(RuleNode *node, string fail_code, int indent);
+static void emitPredicatePreCheck(Rule *rule, RuleNode *node, string fail_code, int indent);
+static void emitNodeMatchResultCode(Rule *rule, RuleNode *node, SearchOp *next_op,
+                                    int indent);
 static void emitEdgeMatcher(Rule *rule, RuleEdge *left_edge, SearchOp *next_op);
 static void emitLoopEdgeMatcher(Rule *rule, RuleEdge *left_edge, SearchOp *next_op);
 static void emitEdgeFromNodeMatcher(Rule *rule, RuleEdge *left_edge, bool source,
                                     bool initialise, bool exit, SearchOp *next_op);
+static int collectJoinNodes(RuleEdge *left_edge, bool source, SearchOp *operation,
+                            int *join_nodes, bool *join_outgoing);
+static void emitJoinEdgeMatcher(Rule *rule, RuleEdge *left_edge, bool source,
+                                int *join_nodes, bool *join_outgoing, int joins,
+                                SearchOp *next_op);
 static void emitEdgeMatchResultCode(int index, SearchOp *next_op, int indent);
 static void emitNextMatcherCall(SearchOp *next_operation);
 
 FILE *header = NULL;
 FILE *file = NULL;
 Searchplan *searchplan = NULL;
+/* Set if the LHS of the rule being generated has more than one connected
+ * component. See generateMatchingCode. */
+static bool disconnected_lhs = false;
+/* The symmetry-breaking constraints of the rule being generated. */
+static SymmetryConstraint *symmetry_constraints = NULL;
+/* Set if the rule being generated is searched for by several threads in large
+ * host graphs (compiler flag -T). See generateMatchingCode. */
+static bool parallel_search = false;
+/* Set if the matchers of the rule being generated do not use the matched flags
+ * of the host graph: the rule is searched for by several threads, or its
+ * matches are collected in batches (compiler flag -b), which leave the items
+ * of the earlier matches of the batch unflagged. */
+static bool morphism_tests = false;
+
+/* Returns the generated test of whether the host node (or edge) item has been
+ * matched. Without the matched flags, the matchers test their own morphism. */
+static string matchedTest(string item, bool node)
+{
+   static char test[64];
+   if(morphism_tests)
+      snprintf(test, sizeof(test), "%sInImage(morphism, %s->index)",
+               node ? "node" : "edge", item);
+   else snprintf(test, sizeof(test), "%s->matched", item);
+   return test;
+}
 
 void generateRules(List *declarations, string output_dir)
 {
@@ -55,7 +97,28 @@ void generateRules(List *declarations, string output_dir)
                * program. */
               decl->rule->empty_lhs = rule->lhs == NULL;
               decl->rule->is_predicate = isPredicate(rule);
-              generateRuleCode(rule, decl->rule->is_predicate, output_dir);
+              /* Loops over a single rule are batched if the rule changes the host
+               * graph and its matches can be found from any host node. */
+              decl->rule->batched = batch_matching && !program_tracing &&
+                                    decl->rule->loop_body && rule->lhs != NULL &&
+                                    !rule->is_rooted && !decl->rule->is_predicate;
+              /* The scan of a shared rule set filters its candidates by the
+               * marks and degrees of the nodes that start the searchplans of its
+               * rules, and groups the rules by these marks. */
+              if(decl->rule->in_shared_set && rule->lhs != NULL)
+              {
+                 Searchplan *plan = generateSearchplan(rule->lhs, false);
+                 RuleNode *first = getRuleNode(rule->lhs, plan->first->index);
+                 decl->rule->first_mark = first->label.mark;
+                 decl->rule->first_indegree = first->indegree;
+                 decl->rule->first_outdegree = first->outdegree;
+                 decl->rule->first_degree = first->indegree + first->outdegree +
+                                            first->bidegree;
+                 freeSearchplan(plan);
+              }
+              generateRuleCode(rule, decl->rule->is_predicate, decl->rule->looped,
+                               decl->rule->in_shared_set, decl->rule->batched,
+                               output_dir);
               freeRule(rule);
               break;
          }
@@ -69,7 +132,8 @@ void generateRules(List *declarations, string output_dir)
 }
 
 /* Create a C module to match and apply the rule. */
-void generateRuleCode(Rule *rule, bool predicate, string output_dir)
+void generateRuleCode(Rule *rule, bool predicate, bool looped, bool shared,
+                      bool batched, string output_dir)
 {
    /* Create files <output dir>/<rule name>.h and <output dir>/<rule name>.c */
    int length = strlen(output_dir) + strlen(rule->name) + 3;
@@ -98,13 +162,18 @@ void generateRuleCode(Rule *rule, bool predicate, string output_dir)
       exit(1);
    }
 
-   PTH("#include \"globals.h\"\n"
+   PTH("#include \"adjacency.h\"\n"
+       "#include \"candidates.h\"\n"
+       "#include \"globals.h\"\n"
        "#include \"graph.h\"\n"
        "#include \"label.h\"\n"
        "#include \"graphStacks.h\"\n"
        "#include \"hostParser.h\"\n"
        "#include \"morphism.h\"\n"
-       "#include \"tracing.h\"\n\n");
+       "#include \"tracing.h\"\n");
+   if(incremental_matching && looped) PTH("#include \"matchStore.h\"\n");
+   if(match_threads > 1 || batched) PTH("#include \"parallel.h\"\n");
+   PTH("\n");
    PTF("#include \"%s.h\"\n\n", rule->name);
 
    if(rule->condition != NULL)
@@ -114,14 +183,14 @@ void generateRuleCode(Rule *rule, bool predicate, string output_dir)
        * varables, one for each predicate in the condition.
        * The second iteration writes the function to evaluate the condition.
        * The third iteration writes the functions to evaluate the predicates. */
-      generateConditionVariables(rule->condition);
+      generateConditionVariables(rule->condition, match_threads > 1);
       PTF("\n");
       generateConditionEvaluator(rule->condition, false);
       generatePredicateEvaluators(rule, rule->condition);
    }
    if(rule->lhs != NULL) 
    {
-      generateMatchingCode(rule, predicate);
+      generateMatchingCode(rule, predicate, looped, shared, batched);
       if(!predicate)
       {
          if(rule->rhs == NULL) generateRemoveLHSCode(rule->name);
@@ -137,16 +206,55 @@ void generateRuleCode(Rule *rule, bool predicate, string output_dir)
    return;
 }
 
-static void generateMatchingCode(Rule *rule, bool predicate)
+static void generateMatchingCode(Rule *rule, bool predicate, bool looped, bool shared,
+                                 bool batched)
 {
-   searchplan = generateSearchplan(rule->lhs); 
+   /* The matching functions of a rule in a shared rule set or with batched
+    * loops start from a node. */
+   searchplan = generateSearchplan(rule->lhs, !shared && !batched);
    if(searchplan->first == NULL)
    {
       print_to_log("Error: empty searchplan. Aborting.\n");
       freeSearchplan(searchplan);
       return;
    }
-   SearchOp *operation = searchplan->first;
+   symmetry_constraints = breakSymmetries(rule, searchplan);
+   /* With incremental matching, a rule called inside a loop maintains a match
+    * store for its first searchplan operation if that operation matches a
+    * non-root node. Root nodes are already found through the root node list. */
+   bool match_store = incremental_matching && looped && searchplan->first->type == 'n';
+   /* Similarly, with locality-seeded matching, the first node of such a rule is
+    * first searched for near the previous rule application. */
+   bool local = locality_matching && looped && searchplan->first->type == 'n';
+   /* Otherwise, the candidates for a non-root first node are divided between
+    * several threads if the host graph is large enough (see parallel.h). */
+   parallel_search = match_threads > 1 && !match_store && !local && !shared &&
+                     searchplan->first->type == 'n';
+   morphism_tests = parallel_search || batched;
+   if(match_store)
+   {
+      PTF("static MatchStore *match_store = NULL;\n\n");
+      emitNodeFilter(getRuleNode(rule->lhs, searchplan->first->index));
+   }
+   /* Each searchplan operation of type 'n' or 'r' after the first starts a new
+    * connected component of the LHS. If there are several components, each
+    * component after the first is matched on its own before the whole LHS is
+    * searched for, so that a component with no match is detected before the
+    * matches of the earlier components are enumerated. In the search for the
+    * whole LHS, a later component can then only fail because of injectivity or
+    * a constraint shared with an earlier component (a condition or a variable),
+    * which is when backtracking into the earlier components is necessary.
+    * When checking_component is set, the last matching function of a component
+    * returns true instead of calling the first function of the next component. */
+   SearchOp *operation = searchplan->first->next;
+   disconnected_lhs = false;
+   while(operation != NULL)
+   {
+      if(operation->type == 'n' || operation->type == 'r') disconnected_lhs = true;
+      operation = operation->next;
+   }
+   if(disconnected_lhs) PTF("static bool checking_component = false;\n\n");
+   operation = searchplan->first;
    /* Iterator over the searchplan to print the prototypes of the matching functions. */
    while(operation != NULL)
    {
@@ -179,11 +287,33 @@ static void generateMatchingCode(Rule *rule, bool predicate)
       }
       operation = operation->next;
    }
+   /* The failure of a rule is only remembered if the host graph is never
+    * replaced by a copy, whose class epochs predate the failure. */
+   bool remember_failure = !graph_copying;
+   if(remember_failure)
+   {
+      PTF("\n/* The value of change_epoch when the rule last failed, or 0. */\n");
+      PTF("static unsigned long failed_epoch = 0;\n");
+   }
    /* Generate the main matching function which sets up the runtime matching 
     * environment and calls the first matching function. */
    PTH("bool match%s(Morphism *morphism);\n\n", rule->name);
    PTF("\nbool match%s(Morphism *morphism)\n", rule->name);
    PTF("{\n");
+   if(remember_failure)
+   {
+      PTFI("if(failed_epoch > 0 && !classesChangedSince(host, 0x%x, failed_epoch))\n",
+           3, getNodeClasses(rule));
+      PTFI("{\n", 3);
+      if (program_tracing) { PTFI("traceRuleMatch(morphism, false);\n", 6); }
+      PTFI("return false;\n", 6);
+      PTFI("}\n\n", 3);
+   }
+   if(match_store)
+   {
+      PTFI("if(match_store == NULL) match_store = makeMatchStore(host, filter_n%d);\n\n",
+           3, searchplan->first->index);
+   }
 
    PTFI("if(%d > host->number_of_nodes || %d > host->number_of_edges)\n",
         3, rule->lhs->node_index, rule->lhs->edge_index);
@@ -191,12 +321,42 @@ static void generateMatchingCode(Rule *rule, bool predicate)
    if (program_tracing) { PTFI("traceRuleMatch(morphism, false);\n", 6); }
    PTFI("return false;\n", 6);
    PTFI("}\n\n", 3);
+   emitCountCheck(rule);
+
+   if(disconnected_lhs)
+   {
+      PTFI("/* Check that each further connected component of the LHS matches. */\n", 3);
+      PTFI("bool component_match = true;\n", 3);
+      PTFI("checking_component = true;\n", 3);
+      operation = searchplan->first->next;
+      while(operation != NULL)
+      {
+         if(operation->type == 'n' || operation->type == 'r')
+         {
+            PTFI("if(component_match)\n", 3);
+            PTFI("{\n", 3);
+            PTFI("component_match = match_n%d(morphism);\n", 6, operation->index);
+            PTFI("initialiseMorphism(morphism, host);\n", 6);
+            PTFI("}\n", 3);
+         }
+         operation = operation->next;
+      }
+      PTFI("checking_component = false;\n", 3);
+      if(rule->condition != NULL) generateConditionReset(rule->condition, 3);
+      PTFI("if(!component_match)\n", 3);
+      PTFI("{\n", 3);
+      if(remember_failure) PTFI("failed_epoch = change_epoch;\n", 6);
+      if (program_tracing) { PTFI("traceRuleMatch(morphism, false);\n", 6); }
+      PTFI("return false;\n", 6);
+      PTFI("}\n\n", 3);
+   }
 
    char item = searchplan->first->is_node ? 'n' : 'e';
    
    if(predicate)
    {
       PTFI("bool match = match_%c%d(morphism);\n", 3, item, searchplan->first->index);
+      if(remember_failure) PTFI("if(!match) failed_epoch = change_epoch;\n", 3);
       /* Before resetting the morphism below, trace the match if tracing is enabled. */
       if (program_tracing) { PTFI("traceRuleMatch(morphism, match);\n", 3); }
       /* Reset the matched flags in the host graph. This is normally done after
@@ -213,6 +373,7 @@ static void generateMatchingCode(Rule *rule, bool predicate)
       PTFI("}\n", 3);
       PTFI("else\n", 3);
       PTFI("{\n", 3);
+      if(remember_failure) PTFI("failed_epoch = change_epoch;\n", 6);
       if (program_tracing) { PTFI("traceRuleMatch(morphism, false);\n", 6); }
       PTFI("initialiseMorphism(morphism, host);\n", 6);
       PTFI("return false;\n", 6);
@@ -224,18 +385,31 @@ static void generateMatchingCode(Rule *rule, bool predicate)
    operation = searchplan->first;
    RuleNode *node = NULL;
    RuleEdge *edge = NULL;
+   /* Used by join matching. An edge has at most one join node per LHS edge. */
+   int join_nodes[rule->lhs->edge_index + 1], joins = 0;
+   bool join_outgoing[rule->lhs->edge_index + 1];
    while(operation != NULL)
    {
       switch(operation->type)
       {        
          case 'r': 
               node = getRuleNode(rule->lhs, operation->index);
+              if(shared && operation == searchplan->first)
+                 emitNodeMatcher(rule, node, false, true, operation->next);
               emitRootNodeMatcher(rule, node, operation->next);
               break;
 
          case 'n': 
               node = getRuleNode(rule->lhs, operation->index);
-              emitNodeMatcher(rule, node, operation->next);
+              if(operation != searchplan->first)
+              {
+                 emitNodeMatcher(rule, node, false, false, operation->next);
+                 break;
+              }
+              if(local || shared || parallel_search || batched)
+                 emitNodeMatcher(rule, node, false, true, operation->next);
+              if(local) emitLocalNodeMatcher(node, match_store);
+              else emitNodeMatcher(rule, node, match_store, false, operation->next);
               break;
 
          case 'i': 
@@ -261,7 +435,14 @@ static void generateMatchingCode(Rule *rule, bool predicate)
               {
                  emitEdgeFromNodeMatcher(rule, edge, true, true, false, operation->next);
                  emitEdgeFromNodeMatcher(rule, edge, false, false, true, operation->next);
+                 break;
               }
+              /* The threads of a parallel search cannot build the sorted
+               * neighbour lists of the host graph, so join matching is off. */
+              if(join_matching && !(morphism_tests && match_threads > 1))
+                 joins = collectJoinNodes(edge, true, operation, join_nodes, join_outgoing);
+              if(joins > 0) emitJoinEdgeMatcher(rule, edge, true, join_nodes, join_outgoing,
+                                                joins, operation->next);
               else emitEdgeFromNodeMatcher(rule, edge, true, true, true, operation->next);
               break;
 
@@ -271,7 +452,12 @@ static void generateMatchingCode(Rule *rule, bool predicate)
               {
                  emitEdgeFromNodeMatcher(rule, edge, false, true, false, operation->next);
                  emitEdgeFromNodeMatcher(rule, edge, true, false, true, operation->next);
+                 break;
               }
+              if(join_matching && !(morphism_tests && match_threads > 1))
+                 joins = collectJoinNodes(edge, false, operation, join_nodes, join_outgoing);
+              if(joins > 0) emitJoinEdgeMatcher(rule, edge, false, join_nodes, join_outgoing,
+                                                joins, operation->next);
               else emitEdgeFromNodeMatcher(rule, edge, false, true, true, operation->next);
               break;
          
@@ -282,9 +468,196 @@ static void generateMatchingCode(Rule *rule, bool predicate)
       }
       operation = operation->next;
    }
+   if(shared) emitSharedSetMatcher(rule, predicate, remember_failure);
+   if(batched) emitBatchCollector(rule);
    freeSearchplan(searchplan);
+   freeSymmetryConstraints(symmetry_constraints);
+   symmetry_constraints = NULL;
+   parallel_search = false;
+   morphism_tests = false;
+}
+
+/* Emits the entry points used by the runtime code of a shared rule set (see
+ * isSharedRuleSet in analysis.h). mayMatch<rule_name> runs the constant-time
+ * tests of the main matching function: whether the rule failed with none of
+ * its node classes changed since, and the tests of the host graph's element
+ * counts. It is called once before the scan of the host graph, which leaves
+ * out the rule if it returns false. If the scan finds no match of any rule, it
+ * calls failed<rule_name> for the rules it searched for, which records the
+ * failure as the main matching function does. In match<rule_name>FromNode, the first LHS node is
+ * matched only to the passed host node, which the caller draws from the host
+ * graph's root node list if the LHS is rooted, and from the node array
+ * otherwise. Unlike the main matching function, the component check of a
+ * disconnected LHS is not performed, since the function is called for each
+ * candidate host node. */
+static void emitSharedSetMatcher(Rule *rule, bool predicate, bool remember_failure)
+{
+   PTH("bool mayMatch%s(void);\n", rule->name);
+   PTF("bool mayMatch%s(void)\n", rule->name);
+   PTF("{\n");
+   if(remember_failure)
+      PTFI("if(failed_epoch > 0 && !classesChangedSince(host, 0x%x, failed_epoch)) "
+           "return false;\n", 3, getNodeClasses(rule));
+   PTFI("if(%d > host->number_of_nodes || %d > host->number_of_edges) return false;\n",
+        3, rule->lhs->node_index, rule->lhs->edge_index);
+   emitCountCheck(rule);
+   PTFI("return true;\n", 3);
+   PTF("}\n\n");
+
+   if(remember_failure)
+   {
+      PTH("void failed%s(void);\n", rule->name);
+      PTF("void failed%s(void)\n", rule->name);
+      PTF("{\n");
+      PTFI("failed_epoch = change_epoch;\n", 3);
+      PTF("}\n\n");
+   }
+
+   PTH("bool match%sFromNode(Morphism *morphism, Node *host_node);\n\n", rule->name);
+   PTF("bool match%sFromNode(Morphism *morphism, Node *host_node)\n", rule->name);
+   PTF("{\n");
+   PTFI("bool match = try_n%d(morphism, host_node);\n", 3, searchplan->first->index);
+   /* As in the main matching function, the morphism of a predicate rule is reset
+    * in any case, and the morphism of other rules only if matching failed. */
+   if(predicate) PTFI("initialiseMorphism(morphism, host);\n", 3);
+   else PTFI("if(!match) initialiseMorphism(morphism, host);\n", 3);
+   PTFI("return match;\n", 3);
+   PTF("}\n\n");
+}
+
+/* Emits the function called by a batched loop over the rule (compiler flag -b)
+ * to collect a batch of matches (see lib/parallel.h). Each match is started
+ * from a host node by the tester of the first searchplan operation. Bit i of
+ * the mask passed to makeMatchBatch is set if LHS node i is sharable. */
+static void emitBatchCollector(Rule *rule)
+{
+   unsigned long long sharable_nodes = 0;
+   int index;
+   for(index = 0; index < rule->lhs->node_index && index < 64; index++)
+      if(isSharableNode(getRuleNode(rule->lhs, index))) sharable_nodes |= 1ULL << index;
+
+   PTH("MatchBatch *collect%s(void);\n\n", rule->name);
+   PTF("MatchBatch *collect%s(void)\n", rule->name);
+   PTF("{\n");
+   PTFI("static MatchBatch *batch = NULL;\n", 3);
+   PTFI("if(batch == NULL) batch = makeMatchBatch(%d, %d, %d, 0x%llxULL);\n", 3,
+        rule->lhs->node_index, rule->lhs->edge_index, rule->variables, sharable_nodes);
+   PTFI("if(%d > host->number_of_nodes || %d > host->number_of_edges) batch->size = 0;\n",
+        3, rule->lhs->node_index, rule->lhs->edge_index);
+   PTFI("else collectMatches(host, batch, try_n%d);\n", 3, searchplan->first->index);
+   PTFI("return batch;\n", 3);
+   PTF("}\n\n");
+}
+
+
+/* Adds the count tests of one kind of LHS item to terms. The host graph must
+ * have at least marks[m] items with mark m, and at least as many marked items
+ * as there are LHS items with a mark other than NONE, including those marked
+ * ANY (marks[HOST_MARKS]). It must have at least lengths[l] items with label
+ * length l, the last entry counting the labels of length COUNTED_LENGTHS - 1 or
+ * more. */
+static int addCountTerms(char terms[][80], int count, string items, int *marks,
+                         int *lengths)
+{
+   int index, marked = marks[ANY];
+   for(index = 0; index < HOST_MARKS; index++)
+   {
+      if(marks[index] == 0) continue;
+      sprintf(terms[count++], "host->counts.%s_marks[%d] < %d", items, index,
+              marks[index]);
+      if(index != NONE) marked += marks[index];
+   }
+   if(marks[ANY] > 0)
+      sprintf(terms[count++], "host->number_of_%ss - host->counts.%s_marks[0] < %d",
+              items, items, marked);
+   for(index = 0; index < COUNTED_LENGTHS; index++)
+      if(lengths[index] > 0)
+         sprintf(terms[count++], "host->counts.%s_lengths[%d] < %d", items, index,
+                 lengths[index]);
+   return count;
+}
+
+/* Emits a test of the host graph's element counts (see graph.h) against the LHS.
+ * Matching is injective, so the rule cannot match if the host graph has fewer
+ * items of some kind than the LHS: nodes or edges with a given mark or label
+ * length, or root nodes. Only labels without a list variable have a fixed
+ * length. The test takes constant time, so a rule that does not match is often
+ * rejected without searching the host graph. Nothing is emitted if the LHS
+ * constrains no count. */
+static void emitCountCheck(Rule *rule)
+{
+   int node_marks[HOST_MARKS + 1] = {0}, edge_marks[HOST_MARKS + 1] = {0};
+   int node_lengths[COUNTED_LENGTHS] = {0}, edge_lengths[COUNTED_LENGTHS] = {0};
+   int root_nodes = 0, index;
+   for(index = 0; index < rule->lhs->node_index; index++)
+   {
+      RuleNode *node = getRuleNode(rule->lhs, index);
+      node_marks[node->label.mark]++;
+      if(node->root) root_nodes++;
+      if(!hasListVariable(node->label))
+      {
+         int length = node->label.length;
+         node_lengths[length < COUNTED_LENGTHS ? length : COUNTED_LENGTHS - 1]++;
+      }
+   }
+   for(index = 0; index < rule->lhs->edge_index; index++)
+   {
+      RuleEdge *edge = getRuleEdge(rule->lhs, index);
+      edge_marks[edge->label.mark]++;
+      if(!hasListVariable(edge->label))
+      {
+         int length = edge->label.length;
+         edge_lengths[length < COUNTED_LENGTHS ? length : COUNTED_LENGTHS - 1]++;
+      }
+   }
+   /* At most HOST_MARKS + 1 + COUNTED_LENGTHS terms for each kind of item, and
+    * one for the root nodes. */
+   char terms[2 * (HOST_MARKS + 1 + COUNTED_LENGTHS) + 1][80];
+   int count = addCountTerms(terms, 0, "node", node_marks, node_lengths);
+   count = addCountTerms(terms, count, "edge", edge_marks, edge_lengths);
+   if(root_nodes > 0) sprintf(terms[count++], "host->counts.root_nodes < %d", root_nodes);
+   if(count == 0) return;
+
+   PTFI("/* Counts of host items required by the LHS. */\n", 3);
+   for(index = 0; index < count; index++)
+      PTFI("%s%s%s\n", index == 0 ? 3 : 6, index == 0 ? "if(" : "", terms[index],
+           index < count - 1 ? " ||" : ")");
+   PTFI("{\n", 3);
+   if (program_tracing) { PTFI("traceRuleMatch(morphism, false);\n", 6); }
+   PTFI("return false;\n", 6);
+   PTFI("}\n\n", 3);
 }
 
+/* Returns the set of node classes (see graph.h) of the host nodes that the LHS
+ * nodes can match, as a bit mask. Nodes marked ANY match every mark but NONE,
+ * and nodes with a list variable match every label length. A host graph change
+ * that cannot affect a match of the rule leaves these classes untouched:
+ * changes to edges touch the classes of their endpoints, which covers the
+ * degrees, the dangling condition and the edge predicates of the condition. */
+static unsigned int getNodeClasses(Rule *rule)
+{
+   unsigned int classes = 0;
+   int index;
+   for(index = 0; index < rule->lhs->node_index; index++)
+   {
+      RuleNode *node = getRuleNode(rule->lhs, index);
+      MarkType mark;
+      int length;
+      for(mark = 0; mark < HOST_MARKS; mark++)
+      {
+         if(node->label.mark == ANY ? mark == NONE : mark != node->label.mark)
+            continue;
+         for(length = 0; length < COUNTED_LENGTHS; length++)
+         {
+            if(!hasListVariable(node->label) &&
+               length != (node->label.length < COUNTED_LENGTHS ?
+                          node->label.length : COUNTED_LENGTHS - 1)) continue;
+            classes |= 1u << NODE_CLASS(mark, length);
+         }
+      }
+   }
+   return classes;
+}
 
 /* The host node does not match the rule node if:
  * (1) The host node's indegree is strictly less than the rule node's indegree.
@@ -325,6 +698,70 @@ static void emitDegreeCheck(RuleNode *left_node, int indent)
    }
 }
 
+/* Returns true if the LHS edge contributes a bit to the neighbourhood signature
+ * required of the LHS node at one of its ends. Edges with a wildcard mark or to a
+ * node with a wildcard mark are skipped, since they do not determine a single
+ * bit, as are bidirectional edges. Unmarked edges to unmarked nodes are skipped
+ * because the degree check nearly always covers them. */
+static bool isSignatureEdge(RuleEdge *edge, RuleNode *neighbour)
+{
+   if(edge->bidirectional) return false;
+   if(edge->label.mark == ANY || neighbour->label.mark == ANY) return false;
+   return edge->label.mark != NONE || neighbour->label.mark != NONE;
+}
+
+/* Emits a test of the host node's neighbourhood signature (see graph.h) against
+ * the signature bits implied by the marks of the LHS node's incident edges and
+ * of the nodes at their other ends. Nothing is emitted if no edge contributes a
+ * bit. */
+static void emitSignatureCheck(RuleNode *left_node, string fail_code, int indent)
+{
+   int bits = 0;
+   RuleEdges *iterator;
+   for(iterator = left_node->outedges; iterator != NULL; iterator = iterator->next)
+      if(isSignatureEdge(iterator->edge, iterator->edge->target)) bits++;
+   for(iterator = left_node->inedges; iterator != NULL; iterator = iterator->next)
+      if(isSignatureEdge(iterator->edge, iterator->edge->source)) bits++;
+   if(bits == 0) return;
+
+   PTFI("if(!hasSignature(host, host_node->index,\n", indent);
+   for(iterator = left_node->outedges; iterator != NULL; iterator = iterator->next)
+   {
+      RuleEdge *edge = iterator->edge;
+      if(!isSignatureEdge(edge, edge->target)) continue;
+      PTFI("                 SIGNATURE_BIT(true, %d, %d)%s\n", indent, edge->label.mark,
+           edge->target->label.mark, --bits > 0 ? " |" : "))");
+   }
+   for(iterator = left_node->inedges; iterator != NULL; iterator = iterator->next)
+   {
+      RuleEdge *edge = iterator->edge;
+      if(!isSignatureEdge(edge, edge->source)) continue;
+      PTFI("                 SIGNATURE_BIT(false, %d, %d)%s\n", indent, edge->label.mark,
+           edge->source->label.mark, --bits > 0 ? " |" : "))");
+   }
+   PTFI("   %s\n", indent, fail_code);
+}
+
+/* Emits a function that tests a host node against the parts of the LHS node's
+ * match that do not depend on the rest of the match: the mark, the degree check
+ * and, for labels without a list variable, the length of the host list. The
+ * function is the filter of the rule's match store. */
+static void emitNodeFilter(RuleNode *left_node)
+{
+   PTF("static bool filter_n%d(Node *host_node)\n", left_node->index);
+   PTF("{\n");
+   if(left_node->label.mark == ANY)
+      PTFI("if(host_node->label.mark == 0) return false;\n", 3);
+   else PTFI("if(host_node->label.mark != %d) return false;\n", 3, left_node->label.mark);
+   emitDegreeCheck(left_node, 3);
+   PTF("return false;\n");
+   if(!hasListVariable(left_node->label))
+      PTFI("if(host_node->label.length != %d) return false;\n", 3, left_node->label.length);
+   else if(left_node->label.length > 1)
+      PTFI("if(host_node->label.length < %d) return false;\n", 3, left_node->label.length - 1);
+   PTFI("return true;\n", 3);
+   PTF("}\n\n");
+}
  
 /* The emitMatcher functions in this module take an LHS item and emit a function 
  * that searches for a matching host item. The generated code queries the host graph
@@ -356,19 +793,23 @@ static void emitRootNodeMatcher(Rule *rule, RuleNode *left_node, SearchOp *next_
    PTFI("{\n", 3);
    PTFI("Node *host_node = getNode(host, nodes->index);\n", 6);
    PTFI("if(host_node == NULL) continue;\n", 6);
-   PTFI("if(host_node->matched) continue;\n", 6);
+   PTFI("if(%s) continue;\n", 6, matchedTest("host_node", true));
+   emitSymmetryCheck(left_node, "continue;", 6);
    if(left_node->label.mark == ANY)
       PTFI("if(host_node->label.mark == 0) continue;\n", 6);
    else PTFI("if(host_node->label.mark != %d) continue;\n", 6, left_node->label.mark);
    emitDegreeCheck(left_node, 6);  
-   PTF("continue;\n\n");
+   PTF("continue;\n");
+   emitSignatureCheck(left_node, "continue;", 6);
+   PTF("\n");
+   emitPredicatePreCheck(rule, left_node, "continue;", 6);
 
    PTFI("HostLabel label = host_node->label;\n", 6);
    PTFI("bool match = false;\n", 6);
    if(hasListVariable(left_node->label))
       generateVariableListMatchingCode(rule, left_node->label, 6);
    else generateFixedListMatchingCode(rule, left_node->label, 6);
-   emitNodeMatchResultCode(left_node, next_op, 6);
+   emitNodeMatchResultCode(rule, left_node, next_op, 6);
    PTFI("}\n", 3);
    PTFI("return false;\n", 3);
    PTF("}\n\n");
@@ -376,29 +817,145 @@ static void emitRootNodeMatcher(Rule *rule, RuleNode *left_node, SearchOp *next_
 
 /* The rule node is matched "in isolation", in that it is not the source or
  * target of a previously-matched edge. In this case, the candidate host
- * graph nodes are obtained from the appropriate label class tables. */
-static void emitNodeMatcher(Rule *rule, RuleNode *left_node, SearchOp *next_op)
+ * graph nodes are obtained from the appropriate label class tables. 
+ * If from_store is set, the candidates are taken from the rule's match store
+ * while the store is valid. Otherwise, the candidates are the nodes that pass
+ * the mark and degree tests of filterNodes (see candidates.h).
+ * If tester is set, the tests of a single candidate passed by the caller are
+ * emitted instead, in a function try_n<index>. This is used by the matcher of
+ * locality-seeded matching (emitLocalNodeMatcher), by the matcher of shared
+ * rule sets (emitSharedSetMatcher) and by the threads of a parallel search. */
+static void emitNodeMatcher(Rule *rule, RuleNode *left_node, bool from_store,
+                            bool tester, SearchOp *next_op)
 {
-   PTF("static bool match_n%d(Morphism *morphism)\n", left_node->index);
+   /* Code executed when a candidate fails a test. */
+   string fail_code = tester ? "return false;" : "continue;";
+   int indent = tester ? 3 : 6;
+   if(tester)
+   {
+      PTF("static bool try_n%d(Morphism *morphism, Node *host_node)\n", left_node->index);
+      PTF("{\n");
+   }
+   else
+   {
+      PTF("static bool match_n%d(Morphism *morphism)\n", left_node->index);
+      PTF("{\n");
+      if(parallel_search && left_node->index == searchplan->first->index)
+      {
+         PTFI("if(host->nodes.size >= PARALLEL_THRESHOLD)\n", 3);
+         PTFI("return matchInParallel(host, morphism, try_n%d);\n", 6, left_node->index);
+      }
+      if(from_store)
+      {
+         PTFI("bool use_store = match_store->valid;\n", 3);
+         PTFI("int candidates = use_store ? match_store->size : host->nodes.size;\n", 3);
+         PTFI("int candidate;\n", 3);
+         PTFI("for(candidate = 0; candidate < candidates; candidate++)\n", 3);
+         PTFI("{\n", 3);
+         PTFI("int host_index = use_store ? match_store->items[candidate] : candidate;\n", 6);
+         PTFI("Node *host_node = getNode(host, host_index);\n", 6);
+         PTFI("if(host_node == NULL || host_node->index == -1) continue;\n", 6);
+      }
+      else
+      {
+         /* The mark and degree tests are run on blocks of the node array by
+          * filterNodes. Its degree test is weaker than emitDegreeCheck's, so
+          * the degree check is repeated on the candidates. */
+         indent = 9;
+         PTFI("int candidates[FILTER_BLOCK];\n", 3);
+         PTFI("int block, candidate;\n", 3);
+         PTFI("for(block = 0; block < host->nodes.size; block += FILTER_BLOCK)\n", 3);
+         PTFI("{\n", 3);
+         PTFI("int count = filterNodes(host, block, %d, %d, %d, %d, candidates);\n", 6,
+              left_node->label.mark, left_node->indegree, left_node->outdegree,
+              left_node->outdegree + left_node->indegree + left_node->bidegree);
+         PTFI("for(candidate = 0; candidate < count; candidate++)\n", 6);
+         PTFI("{\n", 6);
+         PTFI("Node *host_node = getNode(host, candidates[candidate]);\n", 9);
+      }
+   }
+   PTFI("if(%s) %s\n", indent, matchedTest("host_node", true), fail_code);
+   emitSymmetryCheck(left_node, fail_code, indent);
+   if(tester || from_store)
+   {
+      if(left_node->label.mark == ANY)
+         PTFI("if(host_node->label.mark == 0) %s\n", indent, fail_code);
+      else PTFI("if(host_node->label.mark != %d) %s\n", indent, left_node->label.mark,
+                fail_code);
+   }
+   emitDegreeCheck(left_node, indent);  
+   PTF("%s\n", fail_code);
+   emitSignatureCheck(left_node, fail_code, indent);
+   PTF("\n");
+   emitPredicatePreCheck(rule, left_node, fail_code, indent);
+
+   PTFI("HostLabel label = host_node->label;\n", indent);
+   PTFI("bool match = false;\n", indent);
+   if(hasListVariable(left_node->label))
+      generateVariableListMatchingCode(rule, left_node->label, indent);
+   else generateFixedListMatchingCode(rule, left_node->label, indent);
+   emitNodeMatchResultCode(rule, left_node, next_op, indent);
+   if(tester)
+   {
+      PTFI("return false;\n", 3);
+      PTF("}\n\n");
+      return;
+   }
+   if(!from_store) PTFI("}\n", 6);
+   PTFI("}\n", 3);
+   PTFI("return false;\n", 3);
+   PTF("}\n\n");
+}
+
+/* Emits the matcher of a node matched in isolation in locality-seeded mode. The
+ * candidates are, in order: the nodes recorded by the last rule application
+ * (see touched_nodes in graph.h), their neighbours, and finally every host node
+ * (or every node in the match store). A node may be tested more than once. */
+static void emitLocalNodeMatcher(RuleNode *left_node, bool from_store)
+{
+   int index = left_node->index;
+   PTF("static bool match_n%d(Morphism *morphism)\n", index);
    PTF("{\n");
-   PTFI("int host_index;\n", 3);
-   PTFI("for(host_index = 0; host_index < host->nodes.size; host_index++)\n", 3);
+   PTFI("int touched, counter;\n", 3);
+   PTFI("for(touched = 0; touched < touched_node_count; touched++)\n", 3);
    PTFI("{\n", 3);
+   PTFI("/* The touched node may have been deleted since it was recorded. */\n", 6);
+   PTFI("if(touched_nodes[touched] >= host->nodes.size) continue;\n", 6);
+   PTFI("Node *host_node = getNode(host, touched_nodes[touched]);\n", 6);
+   PTFI("if(host_node->index == -1) continue;\n", 6);
+   PTFI("if(try_n%d(morphism, host_node)) return true;\n", 6, index);
+   PTFI("for(counter = 0; counter < host_node->out_edges.size + 2; counter++)\n", 6);
+   PTFI("{\n", 6);
+   PTFI("Edge *host_edge = getNthOutEdge(host, host_node, counter);\n", 9);
+   PTFI("if(host_edge == NULL) continue;\n", 9);
+   PTFI("if(try_n%d(morphism, getTarget(host, host_edge))) return true;\n", 9, index);
+   PTFI("}\n", 6);
+   PTFI("for(counter = 0; counter < host_node->in_edges.size + 2; counter++)\n", 6);
+   PTFI("{\n", 6);
+   PTFI("Edge *host_edge = getNthInEdge(host, host_node, counter);\n", 9);
+   PTFI("if(host_edge == NULL) continue;\n", 9);
+   PTFI("if(try_n%d(morphism, getSource(host, host_edge))) return true;\n", 9, index);
+   PTFI("}\n", 6);
+   PTFI("}\n\n", 3);
+   PTFI("/* No match near the last rule application: search the whole host graph. */\n", 3);
+   if(from_store)
+   {
+      PTFI("bool use_store = match_store->valid;\n", 3);
+      PTFI("int candidates = use_store ? match_store->size : host->nodes.size;\n", 3);
+      PTFI("int candidate;\n", 3);
+      PTFI("for(candidate = 0; candidate < candidates; candidate++)\n", 3);
+      PTFI("{\n", 3);
+      PTFI("int host_index = use_store ? match_store->items[candidate] : candidate;\n", 6);
+   }
+   else
+   {
+      PTFI("int host_index;\n", 3);
+      PTFI("for(host_index = 0; host_index < host->nodes.size; host_index++)\n", 3);
+      PTFI("{\n", 3);
+   }
    PTFI("Node *host_node = getNode(host, host_index);\n", 6);
    PTFI("if(host_node == NULL || host_node->index == -1) continue;\n", 6);
-   PTFI("if(host_node->matched) continue;\n", 6);
-   if(left_node->label.mark == ANY)
-      PTFI("if(host_node->label.mark == 0) continue;\n", 6);
-   else PTFI("if(host_node->label.mark != %d) continue;\n", 6, left_node->label.mark);
-   emitDegreeCheck(left_node, 6);  
-   PTF("continue;\n\n");
-
-   PTFI("HostLabel label = host_node->label;\n", 6);
-   PTFI("bool match = false;\n", 6);
-   if(hasListVariable(left_node->label))
-      generateVariableListMatchingCode(rule, left_node->label, 6);
-   else generateFixedListMatchingCode(rule, left_node->label, 6);
-   emitNodeMatchResultCode(left_node, next_op, 6);
+   PTFI("if(try_n%d(morphism, host_node)) return true;\n", 6, index);
    PTFI("}\n", 3);
    PTFI("return false;\n", 3);
    PTF("}\n\n");
@@ -422,13 +979,16 @@ static void emitNodeFromEdgeMatcher(Rule *rule, RuleNode *left_node, char type,
 
    string fail_code = (type == 'b') ? "candidate_node = false;" : "return false;";
    if(type == 'b') PTFI("bool candidate_node = true;\n", 3);
-   PTFI("if(host_node->matched) %s\n", 3, fail_code);
+   PTFI("if(%s) %s\n", 3, matchedTest("host_node", true), fail_code);
+   emitSymmetryCheck(left_node, fail_code, 3);
    if(left_node->root) PTFI("if(!(host_node->root)) %s\n", 3, fail_code);
    if(left_node->label.mark == ANY)
       PTFI("if(host_node->label.mark == 0) %s\n", 3, fail_code);
    else PTFI("if(host_node->label.mark != %d) %s\n", 3, left_node->label.mark, fail_code);
    emitDegreeCheck(left_node, 6);  
-   PTF("%s;\n\n", fail_code);
+   PTF("%s;\n", fail_code);
+   emitSignatureCheck(left_node, fail_code, 3);
+   PTF("\n");
 
    /* If the above check fails and the edge is bidirectional, check the other 
     * node incident to the host edge. Otherwise return false. */
@@ -440,15 +1000,19 @@ static void emitNodeFromEdgeMatcher(Rule *rule, RuleNode *left_node, char type,
       if(type == 'i' || type == 'b') 
            PTFI("host_node = getSource(host, host_edge);\n", 6);
       else PTFI("host_node = getTarget(host, host_edge);\n", 6);
-      PTFI("if(host_node->matched) return false;\n", 6);
+      PTFI("if(%s) return false;\n", 6, matchedTest("host_node", true));
+      emitSymmetryCheck(left_node, "return false;", 6);
       if(left_node->root) PTFI("if(!(host_node->root)) return false;\n", 6);
       if(left_node->label.mark == ANY)
 	 PTFI("if(host_node->label.mark == 0) return false;\n", 6);
       else PTFI("if(host_node->label.mark != %d) return false;\n", 6, left_node->label.mark);
       emitDegreeCheck(left_node, 6);  
-      PTF("return false;\n\n");
+      PTF("return false;\n");
+      emitSignatureCheck(left_node, "return false;", 6);
+      PTF("\n");
       PTFI("}\n", 3);
    }
+   emitPredicatePreCheck(rule, left_node, "return false;", 3);
 
    PTFI("HostLabel label = host_node->label;\n", 3);
    PTFI("bool match = false;\n", 3);
@@ -456,31 +1020,152 @@ static void emitNodeFromEdgeMatcher(Rule *rule, RuleNode *left_node, char type,
       generateVariableListMatchingCode(rule, left_node->label, 3);
    else generateFixedListMatchingCode(rule, left_node->label, 3);
 
-   emitNodeMatchResultCode(left_node, next_op, 3);
+   emitNodeMatchResultCode(rule, left_node, next_op, 3);
    PTFI("return false;\n", 3);
    PTF("}\n\n");
 }
 
+/* Emits the symmetry-breaking constraints checked by the matching function of
+ * the LHS node (see symmetry.h). The other node of each constraint is matched
+ * earlier, except when a later connected component of the LHS is checked on its
+ * own, in which case lookupNode returns -1 and the test passes. */
+static void emitSymmetryCheck(RuleNode *node, string fail_code, int indent)
+{
+   SymmetryConstraint *constraint = symmetry_constraints;
+   while(constraint != NULL)
+   {
+      if(constraint->larger == node->index)
+         PTFI("if(host_node->index < lookupNode(morphism, %d)) %s\n", indent,
+              constraint->smaller, fail_code);
+      constraint = constraint->next;
+   }
+}
+
+/* Returns the position of the operation matching the LHS node in the searchplan. */
+static int nodePosition(int index)
+{
+   int position = 0;
+   SearchOp *operation = searchplan->first;
+   while(operation != NULL)
+   {
+      if(operation->is_node && operation->index == index) return position;
+      position++;
+      operation = operation->next;
+   }
+   return position;
+}
+
+/* A predicate is evaluated by the matching function of the last of its argument
+ * nodes in the searchplan: before that, the predicate cannot be decided, and
+ * evaluating it would return immediately. Returns true if the node is that node. */
+static bool evaluatedAtNode(Rule *rule, RuleNode *node, Predicate *predicate)
+{
+   int position = nodePosition(node->index);
+   int index, p;
+   for(index = 0; index < rule->lhs->node_index; index++)
+   {
+      RuleNode *arg_node = getRuleNode(rule->lhs, index);
+      for(p = 0; p < arg_node->predicate_count; p++)
+      {
+         if(arg_node->predicates[p] != predicate) continue;
+         if(nodePosition(index) > position) return false;
+         break;
+      }
+   }
+   return true;
+}
+
+/* Returns true if the predicate depends on the value of a rule variable. The
+ * variables in the label of an edge predicate are not registered with the
+ * variables, so any non-constant atom in such a label counts as a variable. */
+static bool predicateHasVariables(Rule *rule, Predicate *predicate)
+{
+   if(predicate->type == EDGE_PRED && predicate->edge_pred.label.length > 0)
+   {
+      RuleListItem *item = predicate->edge_pred.label.list->first;
+      while(item != NULL)
+      {
+         if(item->atom->type != INTEGER_CONSTANT && item->atom->type != STRING_CONSTANT)
+            return true;
+         item = item->next;
+      }
+   }
+   int index, p;
+   for(index = 0; index < rule->variables; index++)
+   {
+      Variable variable = rule->variable_list[index];
+      for(p = 0; p < variable.predicate_count; p++)
+         if(variable.predicates[p] == predicate) return true;
+   }
+   return false;
+}
+
+static void emitPredicateReset(Predicate *predicate, int indent)
+{
+   if(predicate->negated) PTFI("b%d = false;\n", indent, predicate->bool_id);
+   else PTFI("b%d = true;\n", indent, predicate->bool_id);
+}
+
+/* Predicates of the node with no variable arguments, such as edge predicates and
+ * degree comparisons, do not depend on label matching. They are tested before the
+ * label of the candidate host node is matched, so that candidates violating the
+ * condition are discarded early. The node is temporarily added to the morphism
+ * for the evaluation, and the booleans are reset afterwards because the
+ * predicates are evaluated again by the match result code. */
+static void emitPredicatePreCheck(Rule *rule, RuleNode *node, string fail_code, int indent)
+{
+   int index, count = 0;
+   for(index = 0; index < node->predicate_count; index++)
+   {
+      Predicate *predicate = node->predicates[index];
+      if(!evaluatedAtNode(rule, node, predicate)) continue;
+      if(predicateHasVariables(rule, predicate)) continue;
+      if(count++ == 0)
+      {
+         PTFI("/* Test the predicates that do not depend on the node's label. */\n", indent);
+         PTFI("addNodeMap(morphism, %d, host_node->index, 0);\n", indent, node->index);
+      }
+      PTFI("evaluatePredicate%d(morphism);\n", indent, predicate->bool_id);
+   }
+   if(count == 0) return;
+   PTFI("removeNodeMap(morphism, %d);\n", indent, node->index);
+   PTFI("bool condition_holds = evaluateCondition();\n", indent);
+   for(index = 0; index < node->predicate_count; index++)
+   {
+      Predicate *predicate = node->predicates[index];
+      if(!evaluatedAtNode(rule, node, predicate)) continue;
+      if(predicateHasVariables(rule, predicate)) continue;
+      emitPredicateReset(predicate, indent);
+   }
+   PTFI("if(!condition_holds) %s\n\n", indent, fail_code);
+}
+
 /* Generates code to test the result of label matching a node. If the label
- * matching succeeds, any predicates in which the node participates are evaluated
- * and the condition checked. If everything succeeds, the morphism and matched_nodes
- * array are updated, and matching continues. If not, any runtime boolean variables
- * modified by predicate evaluation are reset, and any assignments made during label
- * matching are undone. */
-static void emitNodeMatchResultCode(RuleNode *node, SearchOp *next_op, int indent)
+ * matching succeeds, the predicates evaluated at this node (see evaluatedAtNode)
+ * are evaluated and the condition checked. If everything succeeds, the morphism
+ * and matched_nodes array are updated, and matching continues. If not, any
+ * runtime boolean variables modified by predicate evaluation are reset, and any
+ * assignments made during label matching are undone. */
+static void emitNodeMatchResultCode(Rule *rule, RuleNode *node, SearchOp *next_op,
+                                    int indent)
 {
    PTFI("if(match)\n", indent);
    PTFI("{\n", indent);
    PTFI("addNodeMap(morphism, %d, host_node->index, new_assignments);\n",
         indent + 3, node->index);
-   PTFI("host_node->matched = true;\n", indent + 3);
-   if(node->predicates != NULL)
+   if(!morphism_tests) PTFI("host_node->matched = true;\n", indent + 3);
+   int index, count = 0;
+   for(index = 0; index < node->predicate_count; index++)
+      if(evaluatedAtNode(rule, node, node->predicates[index])) count++;
+   if(count > 0)
    {
       PTFI("/* Update global booleans representing the node's predicates. */\n", indent + 3);
-      int index;
       for(index = 0; index < node->predicate_count; index++)
+      {
+         if(!evaluatedAtNode(rule, node, node->predicates[index])) continue;
          PTFI("evaluatePredicate%d(morphism);\n", indent + 3, 
               node->predicates[index]->bool_id);
+      }
       if(next_op != NULL) PTFI("bool next_match_result = false;\n", indent + 3);
       PTFI("if(evaluateCondition())", indent + 3);
       if(next_op == NULL)
@@ -504,12 +1189,11 @@ static void emitNodeMatchResultCode(RuleNode *node, SearchOp *next_op, int inden
             indent + 6);
       for(index = 0; index < node->predicate_count; index++)
       { 
-         Predicate *predicate = node->predicates[index];
-         if(predicate->negated) PTFI("b%d = false;\n", indent + 6, predicate->bool_id);
-         else PTFI("b%d = true;\n", indent + 6, predicate->bool_id);
+         if(!evaluatedAtNode(rule, node, node->predicates[index])) continue;
+         emitPredicateReset(node->predicates[index], indent + 6);
       }
       PTFI("removeNodeMap(morphism, %d);\n", indent + 6, node->index);
-      PTFI("host_node->matched = false;\n", indent + 6);  
+      if(!morphism_tests) PTFI("host_node->matched = false;\n", indent + 6);
       PTFI("}\n", indent + 3);
    }
    else
@@ -527,7 +1211,7 @@ static void emitNodeMatchResultCode(RuleNode *node, SearchOp *next_op, int inden
          PTFI("else\n", indent + 3);
          PTFI("{\n", indent + 3);  
          PTFI("removeNodeMap(morphism, %d);\n", indent + 6, node->index);
-         PTFI("host_node->matched = false;\n", indent + 6);  
+         if(!morphism_tests) PTFI("host_node->matched = false;\n", indent + 6);
          PTFI("}\n", indent + 3);
       }
    }
@@ -544,14 +1228,24 @@ static void emitEdgeMatcher(Rule *rule, RuleEdge *left_edge, SearchOp *next_op)
    PTF("static bool match_e%d(Morphism *morphism)\n", left_edge->index);
    PTF("{\n");
    PTFI("int host_index;\n", 3);
-   PTFI("for(host_index = 0; host_index < host->edges.size; host_index++)\n", 3);
-   PTFI("{\n", 3);
-   PTFI("Edge *host_edge = getEdge(host, host_index);\n", 6);
-   PTFI("if(host_edge == NULL || host_edge->index == -1) continue;\n", 6);
-   PTFI("if(host_edge->matched) continue;\n", 6);
-   if(left_edge->label.mark == ANY) 
+   if(left_edge->label.mark == ANY)
+   {
+      PTFI("for(host_index = 0; host_index < host->edges.size; host_index++)\n", 3);
+      PTFI("{\n", 3);
+      PTFI("Edge *host_edge = getEdge(host, host_index);\n", 6);
+      PTFI("if(host_edge == NULL || host_edge->index == -1) continue;\n", 6);
+      PTFI("if(%s) continue;\n", 6, matchedTest("host_edge", false));
       PTFI("if(host_edge->label.mark == 0) continue;\n\n", 6);
-   else PTFI("if(host_edge->label.mark != %d) continue;\n\n", 6, left_edge->label.mark);
+   }
+   else
+   {
+      /* Only the host edges with the mark of the rule edge are visited. */
+      PTFI("IntArray *candidates = getMarkedEdges(host, %d);\n", 3, left_edge->label.mark);
+      PTFI("for(host_index = 0; host_index < candidates->size; host_index++)\n", 3);
+      PTFI("{\n", 3);
+      PTFI("Edge *host_edge = getEdge(host, candidates->items[host_index]);\n", 6);
+      PTFI("if(%s) continue;\n\n", 6, matchedTest("host_edge", false));
+   }
    PTFI("HostLabel label = host_edge->label;\n", 6);
    PTFI("bool match = false;\n", 6);
    if(hasListVariable(left_edge->label))
@@ -577,7 +1271,7 @@ static void emitLoopEdgeMatcher(Rule *rule, RuleEdge *left_edge, SearchOp *next_
    PTFI("{\n", 3);
    PTFI("Edge *host_edge = getNthOutEdge(host, host_node, counter);\n", 6);
    PTFI("if(host_edge == NULL) continue;\n", 6);
-   PTFI("if(host_edge->matched) continue;\n", 6);
+   PTFI("if(%s) continue;\n", 6, matchedTest("host_edge", false));
    PTFI("if(host_edge->source != host_edge->target) continue;\n", 6);
    if(left_edge->label.mark == ANY)
       PTFI("if(host_edge->label.mark == 0) continue;\n\n", 6);
@@ -630,6 +1324,18 @@ static void emitEdgeFromNodeMatcher(Rule *rule, RuleEdge *left_edge, bool source
       PTFI("int start_index = lookupNode(morphism, %d);\n", 3, start_index);
       PTFI("int end_index = lookupNode(morphism, %d);\n", 3, end_index);
       PTFI("if(start_index < 0) return false;\n", 3);
+      PTFI("/* If the end node has been matched, the adjacency bitmap may show\n", 3);
+      PTFI("   that there is no candidate edge without scanning the edges. */\n", 3);
+      if(left_edge->bidirectional)
+      {
+         PTFI("if(end_index >= 0 && !mayBeAdjacent(host, start_index, end_index) &&\n", 3);
+         PTFI("   !mayBeAdjacent(host, end_index, start_index)) return false;\n", 3);
+      }
+      else if(source)
+         PTFI("if(end_index >= 0 && !mayBeAdjacent(host, start_index, end_index)) "
+              "return false;\n", 3);
+      else PTFI("if(end_index >= 0 && !mayBeAdjacent(host, end_index, start_index)) "
+                "return false;\n", 3);
       PTFI("Node *host_node = getNode(host, start_index);\n\n", 3);
       PTFI("int counter;\n", 3);
    }
@@ -647,7 +1353,7 @@ static void emitEdgeFromNodeMatcher(Rule *rule, RuleEdge *left_edge, bool source
    }
 
    PTFI("if(host_edge == NULL) continue;\n", 6);
-   PTFI("if(host_edge->matched) continue;\n", 6);
+   PTFI("if(%s) continue;\n", 6, matchedTest("host_edge", false));
    PTFI("if(host_edge->source == host_edge->target) continue;\n", 6);
    if(left_edge->label.mark == ANY)
       PTFI("if(host_edge->label.mark == 0) continue;\n\n", 6);
@@ -663,7 +1369,7 @@ static void emitEdgeFromNodeMatcher(Rule *rule, RuleEdge *left_edge, bool source
    PTFI("else\n", 6);
    PTFI("{\n", 6);
    PTFI("Node *end_node = getNode(host, host_edge->%s);\n", 9, end_node_type);
-   PTFI("if(end_node->matched) continue;\n", 9);
+   PTFI("if(%s) continue;\n", 9, matchedTest("end_node", true));
    PTFI("}\n\n", 6);
 
    PTFI("HostLabel label = host_edge->label;\n", 6);
@@ -677,6 +1383,111 @@ static void emitEdgeFromNodeMatcher(Rule *rule, RuleEdge *left_edge, bool source
    if(exit) PTFI("return false;\n}\n\n", 3);
 }
 
+/* Returns true if the LHS node is matched by an operation preceding the passed
+ * operation in the searchplan. */
+static bool matchedBefore(int index, SearchOp *operation)
+{
+   SearchOp *previous = searchplan->first;
+   while(previous != operation)
+   {
+      if(previous->is_node && previous->index == index) return true;
+      previous = previous->next;
+   }
+   return false;
+}
+
+/* Join matching (compiler flag -j) applies to a non-bidirectional edge matched
+ * from its start node whose end node is not yet matched and has other edges to
+ * matched nodes. In a cyclic LHS, these edges close the cycles through the end
+ * node. Writes the matched nodes at the other end of these edges to join_nodes
+ * and returns their number. join_outgoing[i] is set if the end node is the
+ * target of the edge from join_nodes[i], so that the end node is one of its
+ * out-neighbours. Bidirectional edges and loops are skipped. */
+static int collectJoinNodes(RuleEdge *left_edge, bool source, SearchOp *operation,
+                            int *join_nodes, bool *join_outgoing)
+{
+   RuleNode *end_node = source ? left_edge->target : left_edge->source;
+   if(matchedBefore(end_node->index, operation)) return 0;
+   int joins = 0;
+   RuleEdges *iterator = end_node->outedges;
+   while(iterator != NULL)
+   {
+      RuleEdge *edge = iterator->edge;
+      if(edge != left_edge && !edge->bidirectional && edge->target != end_node &&
+         matchedBefore(edge->target->index, operation))
+      {
+         join_nodes[joins] = edge->target->index;
+         join_outgoing[joins++] = false;
+      }
+      iterator = iterator->next;
+   }
+   iterator = end_node->inedges;
+   while(iterator != NULL)
+   {
+      RuleEdge *edge = iterator->edge;
+      if(edge != left_edge && !edge->bidirectional && edge->source != end_node &&
+         matchedBefore(edge->source->index, operation))
+      {
+         join_nodes[joins] = edge->source->index;
+         join_outgoing[joins++] = true;
+      }
+      iterator = iterator->next;
+   }
+   return joins;
+}
+
+/* Emits the matcher of an edge to which join matching applies (see
+ * collectJoinNodes). Instead of trying every edge of the start node, the
+ * candidates for the end node are enumerated by a leapfrog join of the sorted
+ * neighbour lists of the start node and of the join nodes (see adjacency.h).
+ * Only the edges of the start node to these candidates are tried. The closing
+ * edges are still matched by their own searchplan operations. */
+static void emitJoinEdgeMatcher(Rule *rule, RuleEdge *left_edge, bool source,
+                                int *join_nodes, bool *join_outgoing, int joins,
+                                SearchOp *next_op)
+{
+   int start_index = source ? left_edge->source->index : left_edge->target->index;
+   PTF("static bool match_e%d(Morphism *morphism)\n", left_edge->index);
+   PTF("{\n");
+   PTFI("/* Start node is the already-matched node from which the candidate\n", 3);
+   PTFI("   edges are drawn. End node is unmatched and must also be adjacent to\n", 3);
+   PTFI("   the images of the join nodes. */\n", 3);
+   PTFI("int start_index = lookupNode(morphism, %d);\n", 3, start_index);
+   PTFI("if(start_index < 0) return false;\n", 3);
+   PTFI("Leapfrog join;\n", 3);
+   PTFI("initLeapfrog(&join);\n", 3);
+   PTFI("addLeapfrogNode(&join, host, start_index, %s);\n", 3, source ? "true" : "false");
+   int join;
+   for(join = 0; join < joins; join++)
+      PTFI("addLeapfrogNode(&join, host, lookupNode(morphism, %d), %s);\n", 3,
+           join_nodes[join], join_outgoing[join] ? "true" : "false");
+   PTFI("int end_index;\n", 3);
+   PTFI("while((end_index = nextLeapfrogNode(&join)) >= 0)\n", 3);
+   PTFI("{\n", 3);
+   PTFI("if(end_index == start_index) continue;\n", 6);
+   PTFI("if(%s) continue;\n", 6, matchedTest("getNode(host, end_index)", true));
+   PTFI("/* Try each edge from the start node to the candidate end node. */\n", 6);
+   PTFI("int position;\n", 6);
+   PTFI("for(position = join.positions[0]; position < join.lists[0].size &&\n", 6);
+   PTFI("    join.lists[0].items[position].node == end_index; position++)\n", 6);
+   PTFI("{\n", 6);
+   PTFI("Edge *host_edge = getEdge(host, join.lists[0].items[position].edge);\n", 9);
+   PTFI("if(%s) continue;\n", 9, matchedTest("host_edge", false));
+   if(left_edge->label.mark == ANY)
+      PTFI("if(host_edge->label.mark == 0) continue;\n\n", 9);
+   else PTFI("if(host_edge->label.mark != %d) continue;\n\n", 9, left_edge->label.mark);
+   PTFI("HostLabel label = host_edge->label;\n", 9);
+   PTFI("bool match = false;\n", 9);
+   if(hasListVariable(left_edge->label))
+      generateVariableListMatchingCode(rule, left_edge->label, 9);
+   else generateFixedListMatchingCode(rule, left_edge->label, 9);
+   emitEdgeMatchResultCode(left_edge->index, next_op, 9);
+   PTFI("}\n", 6);
+   PTFI("}\n", 3);
+   PTFI("return false;\n", 3);
+   PTF("}\n\n");
+}
+
 /* Generates code to test the result of label matching a edge. If the label matching
  * succeeds, the morphism and matched_edges array are updated, and matching
  * continues. If not,  any assignments made during label matching are undone. */
@@ -685,7 +1496,7 @@ static void emitEdgeMatchResultCode(int index, SearchOp *next_op, int indent)
    PTFI("if(match)\n", indent);
    PTFI("{\n", indent);
    PTFI("addEdgeMap(morphism, %d, host_edge->index, new_assignments);\n", indent + 3, index);
-   PTFI("host_edge->matched = true;\n", indent + 3);
+   if(!morphism_tests) PTFI("host_edge->matched = true;\n", indent + 3);
    if(next_op == NULL)
    {
       PTFI("/* All items matched! */\n", indent);
@@ -699,7 +1510,7 @@ static void emitEdgeMatchResultCode(int index, SearchOp *next_op, int indent)
       PTFI("else\n", indent + 3);
       PTFI("{\n", indent + 3);                              
       PTFI("removeEdgeMap(morphism, %d);\n", indent + 6, index);
-      PTFI("host_edge->matched = false;\n", indent + 6); 
+      if(!morphism_tests) PTFI("host_edge->matched = false;\n", indent + 6);
       PTFI("}\n", indent + 3);
    } 
    PTFI("}\n", indent);
@@ -712,7 +1523,10 @@ static void emitNextMatcherCall(SearchOp *next_operation)
    {
       case 'n':
       case 'r':
-           PTF("match_n%d(morphism)", next_operation->index);
+           /* The next operation starts a new connected component. */
+           if(disconnected_lhs) 
+              PTF("checking_component || match_n%d(morphism)", next_operation->index);
+           else PTF("match_n%d(morphism)", next_operation->index);
            break;
 
       case 'i':
@@ -746,6 +1560,8 @@ void generateRemoveLHSCode(string rule_name)
    PTFI("Node* node;\n\n", 3);
 
    if (program_tracing) { PTFI("traceBeginContext(\"apply\");\n", 3); }
+   /* The rule preserves no nodes, so there is no locality to record. */
+   if(locality_matching) PTFI("resetTouchedNodes();\n", 3);
 
    PTFI("for(count = 0; count < morphism->edges; count++)\n", 3);
    PTFI("{\n", 3);
@@ -799,6 +1615,7 @@ void generateAddRHSCode(Rule *rule)
       if(variable.used_by_rule) generateVariableCode(index, variable.type);
    }
    PTF("\n");
+   if(locality_matching) PTFI("resetTouchedNodes();\n", 3);
    /* Flag to prevent repeated writing of "label = blank_label" when
     * consecutive blank nodes are added to the graph. */
    bool blank_label = false;
@@ -825,6 +1642,7 @@ void generateAddRHSCode(Rule *rule)
       PTFI("int node_array_size%d = host->nodes.size;\n", 3, index);
       PTFI("index = addNode(host, %d, label);\n", 3, node->root);
       if(rule->adds_edges) PTFI("map[%d] = index;\n", 3, node->index);
+      if(locality_matching) PTFI("addTouchedNode(index);\n", 3);
       PTFI("/* If the node array size has not increased after the node addition, then\n", 3);
       PTFI("   the node was added to a hole in the array. */\n", 3);
       PTFI("if(record_changes) { ", 3);
@@ -903,6 +1721,18 @@ void generateApplicationCode(Rule *rule)
             PTFI("int outdegree%d = getOutdegree(host, node_index);\n", 3, index);
       }
    }
+   if(locality_matching)
+   {
+      /* Record the host nodes matched by interface nodes. Nodes added by the
+       * rule are recorded in (3). */
+      PTFI("resetTouchedNodes();\n", 3);
+      for(index = 0; index < rule->lhs->node_index; index++)
+      {
+         RuleNode *node = getRuleNode(rule->lhs, index);
+         if(node->interface != NULL)
+            PTFI("addTouchedNode(lookupNode(morphism, %d));\n", 3, index);
+      }
+   }
    bool label_declared = false, host_edge_index_declared = false,
         host_node_index_declared = false,
         edge_pointer_declared = false, node_pointer_declared = false;
@@ -1177,6 +2007,7 @@ void generateApplicationCode(Rule *rule)
          PTFI("host_node_index = addNode(host, %d, label);\n", 3, node->root);
       }
       if(rule->adds_edges) PTFI("rhs_node_map[%d] = host_node_index;\n", 3, node->index);
+      if(locality_matching) PTFI("addTouchedNode(host_node_index);\n", 3);
       PTFI("/* If the node array size has not increased after the node addition, then\n", 3);
       PTFI("   the node was added to a hole in the array. */\n", 3);
       PTFI("if(record_changes) { ", 3);
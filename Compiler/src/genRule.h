@@ -35,6 +35,7 @@
 #include "globals.h"
 #include "rule.h"
 #include "searchplan.h"
+#include "symmetry.h"
 #include "transform.h"
 
 /* The functions in this module use a static searchplan of the LHS of a rule
@@ -58,8 +59,17 @@
 void generateRules(List *declarations, string output_dir);
 
 /* Create a C module to match and apply the rule. The generated files are
- * called <rule_name>.h and <rule_name>.c.*/
-void generateRuleCode(Rule *rule, bool predicate, string output_dir);
+ * called <rule_name>.h and <rule_name>.c. The looped flag is set if the rule
+ * is called inside a loop: with incremental matching, such rules maintain a
+ * match store at runtime (see lib/matchStore.h). The shared flag is set if the
+ * rule is called in a shared rule set: the module then also defines the
+ * functions mayMatch<rule_name>, match<rule_name>FromNode and, without graph
+ * copying, failed<rule_name> (see isSharedRuleSet in analysis.h). The
+ * batched flag is set if the loops whose body is a call of the rule apply
+ * batches of matches: the module then also defines the function
+ * collect<rule_name> (see lib/parallel.h). */
+void generateRuleCode(Rule *rule, bool predicate, bool looped, bool shared,
+                      bool batched, string output_dir);
 
 /* The three functions below write the function apply_<rule_name> that makes the 
  * necessary changes to the host graph according to the rule and morphism. 
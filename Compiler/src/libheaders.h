@@ -183,104 +183,722 @@ unsigned char globals_h[] = {
   0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x79, 0x73, 0x2f, 0x73,
   0x74, 0x61, 0x74, 0x2e, 0x68, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c,
   0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x79, 0x73, 0x2f, 0x74, 0x79, 0x70,
-  0x65, 0x73, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64,
-  0x65, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2a, 0x20, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
-  0x20, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x6c, 0x6f, 0x67, 0x5f, 0x66,
-  0x69, 0x6c, 0x65, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20,
-  0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x63,
-  0x6f, 0x70, 0x79, 0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
-  0x42, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x61,
-  0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x79, 0x79, 0x6c, 0x6c, 0x6f, 0x63, 0x20,
-  0x6f, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x59, 0x59, 0x4c, 0x54,
-  0x59, 0x50, 0x45, 0x20, 0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20,
-  0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x0a, 0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x6e, 0x74, 0x65, 0x72, 0x6d,
-  0x69, 0x6e, 0x61, 0x6c, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
-  0x63, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
-  0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x76, 0x61,
-  0x6c, 0x75, 0x65, 0x73, 0x20, 0x75, 0x70, 0x6f, 0x6e, 0x0a, 0x20, 0x2a,
-  0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x61, 0x63,
-  0x68, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x69,
-  0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
-  0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59, 0x50,
-  0x45, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x20, 0x62, 0x75, 0x74, 0x20, 0x49, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x20, 0x69, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x68, 0x65, 0x72, 0x65,
-  0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x76, 0x69,
-  0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x41, 0x53, 0x54, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x2e,
-  0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
-  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59,
-  0x50, 0x45, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x66,
-  0x69, 0x72, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x63,
-  0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
-  0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63,
-  0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a, 0x7d, 0x20, 0x59, 0x59, 0x4c,
-  0x54, 0x59, 0x50, 0x45, 0x3b, 0x0a, 0x0a, 0x23, 0x20, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x49, 0x53, 0x5f, 0x44, 0x45, 0x43, 0x4c, 0x41, 0x52, 0x45, 0x44, 0x20,
-  0x31, 0x20, 0x2f, 0x2a, 0x20, 0x54, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x42,
-  0x69, 0x73, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x59, 0x59,
-  0x4c, 0x54, 0x59, 0x50, 0x45, 0x20, 0x69, 0x73, 0x20, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x2e, 0x20, 0x2a,
-  0x2f, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x47, 0x50, 0x20, 0x32, 0x27, 0x73,
-  0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x79,
-  0x70, 0x65, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65,
-  0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b, 0x49, 0x4e,
-  0x54, 0x45, 0x47, 0x45, 0x52, 0x5f, 0x56, 0x41, 0x52, 0x20, 0x3d, 0x20,
-  0x30, 0x2c, 0x20, 0x43, 0x48, 0x41, 0x52, 0x41, 0x43, 0x54, 0x45, 0x52,
-  0x5f, 0x56, 0x41, 0x52, 0x2c, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47,
-  0x5f, 0x56, 0x41, 0x52, 0x2c, 0x20, 0x41, 0x54, 0x4f, 0x4d, 0x5f, 0x56,
-  0x41, 0x52, 0x2c, 0x20, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x56, 0x41, 0x52,
-  0x7d, 0x20, 0x47, 0x50, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x0a, 0x0a, 0x74,
-  0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20,
-  0x7b, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x52,
-  0x45, 0x44, 0x2c, 0x20, 0x47, 0x52, 0x45, 0x45, 0x4e, 0x2c, 0x20, 0x42,
-  0x4c, 0x55, 0x45, 0x2c, 0x20, 0x47, 0x52, 0x45, 0x59, 0x2c, 0x20, 0x44,
-  0x41, 0x53, 0x48, 0x45, 0x44, 0x2c, 0x20, 0x41, 0x4e, 0x59, 0x7d, 0x20,
-  0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x20, 0x0a, 0x0a,
-  0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d,
-  0x20, 0x7b, 0x49, 0x4e, 0x54, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x20,
-  0x3d, 0x20, 0x30, 0x2c, 0x20, 0x43, 0x48, 0x41, 0x52, 0x5f, 0x43, 0x48,
-  0x45, 0x43, 0x4b, 0x2c, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x5f,
-  0x43, 0x48, 0x45, 0x43, 0x4b, 0x2c, 0x20, 0x41, 0x54, 0x4f, 0x4d, 0x5f,
-  0x43, 0x48, 0x45, 0x43, 0x4b, 0x2c, 0x20, 0x45, 0x44, 0x47, 0x45, 0x5f,
-  0x50, 0x52, 0x45, 0x44, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x51, 0x55, 0x41,
-  0x4c, 0x2c, 0x20, 0x4e, 0x4f, 0x54, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c,
-  0x2c, 0x20, 0x47, 0x52, 0x45, 0x41, 0x54, 0x45, 0x52, 0x2c, 0x20, 0x47,
-  0x52, 0x45, 0x41, 0x54, 0x45, 0x52, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c,
-  0x2c, 0x20, 0x4c, 0x45, 0x53, 0x53, 0x2c, 0x20, 0x4c, 0x45, 0x53, 0x53,
-  0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x2c, 0x20, 0x0a, 0x09, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x42, 0x4f, 0x4f, 0x4c, 0x5f, 0x4e, 0x4f, 0x54,
-  0x2c, 0x20, 0x42, 0x4f, 0x4f, 0x4c, 0x5f, 0x4f, 0x52, 0x2c, 0x20, 0x42,
-  0x4f, 0x4f, 0x4c, 0x5f, 0x41, 0x4e, 0x44, 0x20, 0x7d, 0x20, 0x43, 0x6f,
-  0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x3b,
-  0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e,
-  0x75, 0x6d, 0x20, 0x7b, 0x49, 0x4e, 0x54, 0x45, 0x47, 0x45, 0x52, 0x5f,
-  0x43, 0x4f, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x54, 0x20, 0x3d, 0x20, 0x30,
-  0x2c, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x5f, 0x43, 0x4f, 0x4e,
-  0x53, 0x54, 0x41, 0x4e, 0x54, 0x2c, 0x20, 0x56, 0x41, 0x52, 0x49, 0x41,
-  0x42, 0x4c, 0x45, 0x2c, 0x20, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x2c,
-  0x20, 0x49, 0x4e, 0x44, 0x45, 0x47, 0x52, 0x45, 0x45, 0x2c, 0x0a, 0x20,
+  0x65, 0x73, 0x2e, 0x68, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x20, 0x3c, 0x75, 0x6e, 0x69, 0x73, 0x74, 0x64, 0x2e, 0x68,
+  0x3e, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x63,
+  0x68, 0x61, 0x72, 0x2a, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3b,
+  0x0a, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x46, 0x49, 0x4c,
+  0x45, 0x20, 0x2a, 0x6c, 0x6f, 0x67, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x3b,
+  0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x62, 0x6f, 0x6f, 0x6c,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x69,
+  0x6e, 0x67, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x62,
+  0x6f, 0x6f, 0x6c, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x5f,
+  0x74, 0x72, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x69, 0x6e, 0x63,
+  0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x5f, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72,
+  0x6e, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x69, 0x74, 0x79, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67,
+  0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x62, 0x6f, 0x6f,
+  0x6c, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20,
+  0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x6d,
+  0x61, 0x70, 0x5f, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x3b, 0x0a, 0x65,
+  0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3b,
+  0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x6f,
+  0x72, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72,
+  0x6e, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75,
+  0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x62, 0x72, 0x61, 0x6e, 0x63,
+  0x68, 0x65, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x74, 0x72, 0x69, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x72, 0x75,
+  0x6e, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x53, 0x4f,
+  0x55, 0x52, 0x43, 0x45, 0x5f, 0x4f, 0x52, 0x44, 0x45, 0x52, 0x20, 0x2d,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72,
+  0x61, 0x6d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2e, 0x0a, 0x20, 0x2a, 0x20,
+  0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4f, 0x5f, 0x46, 0x52, 0x4f, 0x4e,
+  0x54, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x69, 0x65, 0x64, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x4d, 0x41, 0x54,
+  0x43, 0x48, 0x5f, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x20, 0x2d, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x74, 0x72, 0x69, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x65,
+  0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x2a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x4f, 0x55, 0x54, 0x44, 0x45, 0x47, 0x52, 0x45, 0x45, 0x2c, 0x20,
-  0x4e, 0x45, 0x47, 0x2c, 0x20, 0x41, 0x44, 0x44, 0x2c, 0x20, 0x53, 0x55,
-  0x42, 0x54, 0x52, 0x41, 0x43, 0x54, 0x2c, 0x20, 0x4d, 0x55, 0x4c, 0x54,
-  0x49, 0x50, 0x4c, 0x59, 0x2c, 0x20, 0x44, 0x49, 0x56, 0x49, 0x44, 0x45,
-  0x2c, 0x20, 0x43, 0x4f, 0x4e, 0x43, 0x41, 0x54, 0x7d, 0x20, 0x41, 0x74,
-  0x6f, 0x6d, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e,
-  0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x47,
-  0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x53, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a,
-  0x00
+  0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+  0x68, 0x61, 0x76, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
+  0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b, 0x53, 0x4f, 0x55, 0x52, 0x43,
+  0x45, 0x5f, 0x4f, 0x52, 0x44, 0x45, 0x52, 0x20, 0x3d, 0x20, 0x30, 0x2c,
+  0x20, 0x4d, 0x4f, 0x56, 0x45, 0x5f, 0x54, 0x4f, 0x5f, 0x46, 0x52, 0x4f,
+  0x4e, 0x54, 0x2c, 0x20, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x43, 0x4f,
+  0x55, 0x4e, 0x54, 0x7d, 0x20, 0x52, 0x75, 0x6c, 0x65, 0x53, 0x65, 0x74,
+  0x50, 0x6f, 0x6c, 0x69, 0x63, 0x79, 0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65,
+  0x72, 0x6e, 0x20, 0x52, 0x75, 0x6c, 0x65, 0x53, 0x65, 0x74, 0x50, 0x6f,
+  0x6c, 0x69, 0x63, 0x79, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x65,
+  0x74, 0x5f, 0x70, 0x6f, 0x6c, 0x69, 0x63, 0x79, 0x3b, 0x0a, 0x0a, 0x2f,
+  0x2a, 0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x75, 0x73, 0x65, 0x73,
+  0x20, 0x61, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x61,
+  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x79, 0x79, 0x6c, 0x6c, 0x6f,
+  0x63, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x59, 0x59,
+  0x4c, 0x54, 0x59, 0x50, 0x45, 0x20, 0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65,
+  0x70, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x6f, 0x6b, 0x65,
+  0x6e, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x6e, 0x74, 0x65,
+  0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6c,
+  0x6c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x75, 0x70, 0x6f, 0x6e, 0x0a,
+  0x20, 0x2a, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2e, 0x20, 0x54,
+  0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+  0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x59, 0x59, 0x4c, 0x54,
+  0x59, 0x50, 0x45, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x62, 0x75, 0x74, 0x20, 0x49, 0x20, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x69, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x68, 0x65,
+  0x72, 0x65, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x41, 0x53, 0x54, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+  0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x59, 0x59, 0x4c,
+  0x54, 0x59, 0x50, 0x45, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+  0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x73, 0x74,
+  0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a, 0x7d, 0x20, 0x59,
+  0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x3b, 0x0a, 0x0a, 0x23, 0x20, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59, 0x50,
+  0x45, 0x5f, 0x49, 0x53, 0x5f, 0x44, 0x45, 0x43, 0x4c, 0x41, 0x52, 0x45,
+  0x44, 0x20, 0x31, 0x20, 0x2f, 0x2a, 0x20, 0x54, 0x65, 0x6c, 0x6c, 0x73,
+  0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x20, 0x69, 0x73, 0x20, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x47, 0x50, 0x20, 0x32,
+  0x27, 0x73, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79,
+  0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b,
+  0x49, 0x4e, 0x54, 0x45, 0x47, 0x45, 0x52, 0x5f, 0x56, 0x41, 0x52, 0x20,
+  0x3d, 0x20, 0x30, 0x2c, 0x20, 0x43, 0x48, 0x41, 0x52, 0x41, 0x43, 0x54,
+  0x45, 0x52, 0x5f, 0x56, 0x41, 0x52, 0x2c, 0x20, 0x53, 0x54, 0x52, 0x49,
+  0x4e, 0x47, 0x5f, 0x56, 0x41, 0x52, 0x2c, 0x20, 0x41, 0x54, 0x4f, 0x4d,
+  0x5f, 0x56, 0x41, 0x52, 0x2c, 0x20, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x56,
+  0x41, 0x52, 0x7d, 0x20, 0x47, 0x50, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x0a,
+  0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75,
+  0x6d, 0x20, 0x7b, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x3d, 0x20, 0x30, 0x2c,
+  0x20, 0x52, 0x45, 0x44, 0x2c, 0x20, 0x47, 0x52, 0x45, 0x45, 0x4e, 0x2c,
+  0x20, 0x42, 0x4c, 0x55, 0x45, 0x2c, 0x20, 0x47, 0x52, 0x45, 0x59, 0x2c,
+  0x20, 0x44, 0x41, 0x53, 0x48, 0x45, 0x44, 0x2c, 0x20, 0x41, 0x4e, 0x59,
+  0x7d, 0x20, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x20,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x73,
+  0x20, 0x61, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65, 0x6d,
+  0x20, 0x63, 0x61, 0x6e, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x28, 0x41,
+  0x4e, 0x59, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x29, 0x2c, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x73, 0x20, 0x64,
+  0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x68, 0x65, 0x64,
+  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x61, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x53, 0x68, 0x61, 0x72, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x28, 0x73,
+  0x65, 0x65, 0x20, 0x6c, 0x69, 0x62, 0x2f, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2e, 0x68, 0x29, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x48, 0x4f, 0x53, 0x54, 0x5f, 0x4d, 0x41, 0x52,
+  0x4b, 0x53, 0x20, 0x36, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x44, 0x5f, 0x4c, 0x45, 0x4e,
+  0x47, 0x54, 0x48, 0x53, 0x20, 0x34, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x48,
+  0x6f, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x74, 0x6f, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x62,
+  0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x0a,
+  0x20, 0x2a, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x72,
+  0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x64, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x6c,
+  0x69, 0x62, 0x2f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x68, 0x29, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x4e, 0x4f, 0x44, 0x45, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x45, 0x53,
+  0x20, 0x28, 0x48, 0x4f, 0x53, 0x54, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x53,
+  0x20, 0x2a, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x44, 0x5f, 0x4c,
+  0x45, 0x4e, 0x47, 0x54, 0x48, 0x53, 0x29, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x4e, 0x4f, 0x44, 0x45, 0x5f, 0x43, 0x4c, 0x41,
+  0x53, 0x53, 0x28, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x29, 0x20, 0x28, 0x28, 0x6d, 0x61, 0x72, 0x6b, 0x29,
+  0x20, 0x2a, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x44, 0x5f, 0x4c,
+  0x45, 0x4e, 0x47, 0x54, 0x48, 0x53, 0x20, 0x2b, 0x20, 0x28, 0x6c, 0x65,
+  0x6e, 0x67, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65,
+  0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b, 0x49, 0x4e,
+  0x54, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x20, 0x3d, 0x20, 0x30, 0x2c,
+  0x20, 0x43, 0x48, 0x41, 0x52, 0x5f, 0x43, 0x48, 0x45, 0x43, 0x4b, 0x2c,
+  0x20, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x5f, 0x43, 0x48, 0x45, 0x43,
+  0x4b, 0x2c, 0x20, 0x41, 0x54, 0x4f, 0x4d, 0x5f, 0x43, 0x48, 0x45, 0x43,
+  0x4b, 0x2c, 0x20, 0x45, 0x44, 0x47, 0x45, 0x5f, 0x50, 0x52, 0x45, 0x44,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x2c, 0x20, 0x4e,
+  0x4f, 0x54, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x2c, 0x20, 0x47, 0x52,
+  0x45, 0x41, 0x54, 0x45, 0x52, 0x2c, 0x20, 0x47, 0x52, 0x45, 0x41, 0x54,
+  0x45, 0x52, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x2c, 0x20, 0x4c, 0x45,
+  0x53, 0x53, 0x2c, 0x20, 0x4c, 0x45, 0x53, 0x53, 0x5f, 0x45, 0x51, 0x55,
+  0x41, 0x4c, 0x2c, 0x20, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x42, 0x4f, 0x4f, 0x4c, 0x5f, 0x4e, 0x4f, 0x54, 0x2c, 0x20, 0x42, 0x4f,
+  0x4f, 0x4c, 0x5f, 0x4f, 0x52, 0x2c, 0x20, 0x42, 0x4f, 0x4f, 0x4c, 0x5f,
+  0x41, 0x4e, 0x44, 0x20, 0x7d, 0x20, 0x43, 0x6f, 0x6e, 0x64, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x3b, 0x0a, 0x0a, 0x74, 0x79,
+  0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b,
+  0x49, 0x4e, 0x54, 0x45, 0x47, 0x45, 0x52, 0x5f, 0x43, 0x4f, 0x4e, 0x53,
+  0x54, 0x41, 0x4e, 0x54, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x53, 0x54,
+  0x52, 0x49, 0x4e, 0x47, 0x5f, 0x43, 0x4f, 0x4e, 0x53, 0x54, 0x41, 0x4e,
+  0x54, 0x2c, 0x20, 0x56, 0x41, 0x52, 0x49, 0x41, 0x42, 0x4c, 0x45, 0x2c,
+  0x20, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x2c, 0x20, 0x49, 0x4e, 0x44,
+  0x45, 0x47, 0x52, 0x45, 0x45, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4f, 0x55, 0x54,
+  0x44, 0x45, 0x47, 0x52, 0x45, 0x45, 0x2c, 0x20, 0x4e, 0x45, 0x47, 0x2c,
+  0x20, 0x41, 0x44, 0x44, 0x2c, 0x20, 0x53, 0x55, 0x42, 0x54, 0x52, 0x41,
+  0x43, 0x54, 0x2c, 0x20, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x50, 0x4c, 0x59,
+  0x2c, 0x20, 0x44, 0x49, 0x56, 0x49, 0x44, 0x45, 0x2c, 0x20, 0x43, 0x4f,
+  0x4e, 0x43, 0x41, 0x54, 0x7d, 0x20, 0x41, 0x74, 0x6f, 0x6d, 0x54, 0x79,
+  0x70, 0x65, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20,
+  0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41,
+  0x4c, 0x53, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int globals_h_len = 4424;
+
+unsigned char adjacency_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e,
+  0x63, 0x79, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x0a, 0x20, 0x20,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x20, 0x20, 0x41, 0x6e, 0x20, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x76, 0x69, 0x65, 0x77,
+  0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6f, 0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+  0x0a, 0x20, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x69, 0x72, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x65,
+  0x6e, 0x64, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77,
+  0x20, 0x6f, 0x66, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6d, 0x65,
+  0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65,
+  0x73, 0x74, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x69, 0x73,
+  0x63, 0x61, 0x72, 0x64, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20,
+  0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2e, 0x68, 0x29, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x65, 0x64, 0x0a, 0x20, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6a, 0x6f,
+  0x69, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20,
+  0x28, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x66, 0x6c,
+  0x61, 0x67, 0x20, 0x2d, 0x6a, 0x29, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x70, 0x61, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74,
+  0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64,
+  0x75, 0x6c, 0x65, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x70, 0x72, 0x6f,
+  0x76, 0x69, 0x64, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6c, 0x65, 0x61, 0x70,
+  0x66, 0x72, 0x6f, 0x67, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x6f, 0x76,
+  0x65, 0x72, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x6e, 0x65,
+  0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x73, 0x2e, 0x20, 0x49, 0x74, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x75, 0x6d,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6f, 0x63,
+  0x63, 0x75, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x6e, 0x63,
+  0x72, 0x65, 0x61, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x72, 0x64, 0x65,
+  0x72, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20,
+  0x20, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x69, 0x6e, 0x20,
+  0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x62, 0x79,
+  0x20, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76,
+  0x65, 0x72, 0x79, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75,
+  0x72, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x6c,
+  0x79, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20,
+  0x61, 0x6e, 0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79,
+  0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
+  0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x0a, 0x20, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x61, 0x20, 0x62, 0x69, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x70, 0x61, 0x69, 0x72,
+  0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x66, 0x69, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20,
+  0x61, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x62, 0x75, 0x64,
+  0x67, 0x65, 0x74, 0x2e, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74,
+  0x65, 0x64, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x73,
+  0x6b, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61,
+  0x70, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x77,
+  0x6f, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x74, 0x20,
+  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x6e,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x2e, 0x0a, 0x0a, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66,
+  0x20, 0x49, 0x4e, 0x43, 0x5f, 0x41, 0x44, 0x4a, 0x41, 0x43, 0x45, 0x4e,
+  0x43, 0x59, 0x5f, 0x48, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x49, 0x4e, 0x43, 0x5f, 0x41, 0x44, 0x4a, 0x41, 0x43, 0x45, 0x4e,
+  0x43, 0x59, 0x5f, 0x48, 0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x20, 0x22, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e,
+  0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20,
+  0x22, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x68, 0x22, 0x0a, 0x0a, 0x74,
+  0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x20, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x3b, 0x0a, 0x7d, 0x20, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62,
+  0x6f, 0x75, 0x72, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+  0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x62, 0x79, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x2e, 0x20, 0x41, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x6f, 0x63, 0x63, 0x75, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x0a,
+  0x20, 0x2a, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e,
+  0x20, 0x69, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6f, 0x77, 0x6e, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79,
+  0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+  0x20, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x65, 0x69,
+  0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x20, 0x2a, 0x69, 0x74, 0x65, 0x6d,
+  0x73, 0x3b, 0x0a, 0x7d, 0x20, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f,
+  0x75, 0x72, 0x4c, 0x69, 0x73, 0x74, 0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70,
+  0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+  0x4e, 0x6f, 0x64, 0x65, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+  0x76, 0x61, 0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x65,
+  0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x6f, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x7d, 0x20, 0x4e,
+  0x6f, 0x64, 0x65, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79,
+  0x3b, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x53, 0x6f, 0x72, 0x74, 0x65, 0x64,
+  0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+  0x69, 0x74, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x64, 0x65,
+  0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x2a, 0x6e,
+  0x6f, 0x64, 0x65, 0x73, 0x3b, 0x0a, 0x7d, 0x20, 0x53, 0x6f, 0x72, 0x74,
+  0x65, 0x64, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x3b,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61,
+  0x72, 0x67, 0x65, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x67,
+  0x6f, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6f,
+  0x75, 0x72, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x2a, 0x20,
+  0x69, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x69, 0x6e, 0x67,
+  0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e,
+  0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69,
+  0x73, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2e, 0x20, 0x2a,
+  0x2f, 0x0a, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4f, 0x75, 0x74, 0x4e, 0x65,
+  0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x73, 0x28, 0x47, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x4e,
+  0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62,
+  0x6f, 0x75, 0x72, 0x73, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x70,
+  0x6f, 0x72, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x69,
+  0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x53, 0x6f, 0x72,
+  0x74, 0x65, 0x64, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79,
+  0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65,
+  0x53, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65,
+  0x6e, 0x63, 0x79, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x4d, 0x41, 0x58, 0x5f, 0x4a, 0x4f, 0x49, 0x4e,
+  0x5f, 0x4c, 0x49, 0x53, 0x54, 0x53, 0x20, 0x38, 0x0a, 0x0a, 0x2f, 0x2a,
+  0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69,
+  0x5d, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x5b, 0x69,
+  0x5d, 0x2e, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6d, 0x6f, 0x73, 0x74,
+  0x0a, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x63, 0x65, 0x6e, 0x74, 0x6c, 0x79,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f,
+  0x67, 0x4e, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79,
+  0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+  0x20, 0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f, 0x67, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f,
+  0x75, 0x72, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73,
+  0x5b, 0x4d, 0x41, 0x58, 0x5f, 0x4a, 0x4f, 0x49, 0x4e, 0x5f, 0x4c, 0x49,
+  0x53, 0x54, 0x53, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x4d,
+  0x41, 0x58, 0x5f, 0x4a, 0x4f, 0x49, 0x4e, 0x5f, 0x4c, 0x49, 0x53, 0x54,
+  0x53, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x3b, 0x0a, 0x7d, 0x20, 0x4c, 0x65, 0x61, 0x70, 0x66,
+  0x72, 0x6f, 0x67, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x69,
+  0x6e, 0x69, 0x74, 0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f, 0x67, 0x28,
+  0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f, 0x67, 0x20, 0x2a, 0x6a, 0x6f,
+  0x69, 0x6e, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x41, 0x64, 0x64, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x2d, 0x6e, 0x65, 0x69,
+  0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x28, 0x6f, 0x75, 0x74,
+  0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65,
+  0x29, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x2d, 0x6e, 0x65, 0x69, 0x67,
+  0x68, 0x62, 0x6f, 0x75, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x0a, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x2e, 0x20, 0x41,
+  0x20, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6c,
+  0x6c, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x73, 0x20,
+  0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x77, 0x68, 0x69,
+  0x63, 0x68, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x65, 0x61, 0x6b,
+  0x65, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x6a,
+  0x6f, 0x69, 0x6e, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x61, 0x64, 0x64, 0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f, 0x67,
+  0x4e, 0x6f, 0x64, 0x65, 0x28, 0x4c, 0x65, 0x61, 0x70, 0x66, 0x72, 0x6f,
+  0x67, 0x20, 0x2a, 0x6a, 0x6f, 0x69, 0x6e, 0x2c, 0x20, 0x47, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x62, 0x6f,
+  0x6f, 0x6c, 0x20, 0x6f, 0x75, 0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x29,
+  0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x73,
+  0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x63, 0x63, 0x75,
+  0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x2d, 0x31, 0x20,
+  0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x6e, 0x6f, 0x6e, 0x65, 0x2e, 0x20, 0x4f, 0x6e, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x0a, 0x20, 0x2a, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x2e, 0x20, 0x2a, 0x2f,
+  0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x4c, 0x65, 0x61,
+  0x70, 0x66, 0x72, 0x6f, 0x67, 0x4e, 0x6f, 0x64, 0x65, 0x28, 0x4c, 0x65,
+  0x61, 0x70, 0x66, 0x72, 0x6f, 0x67, 0x20, 0x2a, 0x6a, 0x6f, 0x69, 0x6e,
+  0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x42, 0x69, 0x74, 0x20, 0x74,
+  0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x6f, 0x77,
+  0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73,
+  0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x6f, 0x75,
+  0x72, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x61,
+  0x72, 0x67, 0x65, 0x74, 0x2e, 0x20, 0x52, 0x6f, 0x77, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x2e, 0x20, 0x41, 0x20, 0x72, 0x6f, 0x77, 0x20, 0x69, 0x73, 0x20, 0x72,
+  0x6f, 0x77, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65,
+  0x6e, 0x63, 0x79, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x6d, 0x65, 0x6e,
+  0x73, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x72, 0x6f, 0x77, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x2a, 0x62,
+  0x69, 0x74, 0x73, 0x3b, 0x0a, 0x7d, 0x20, 0x41, 0x64, 0x6a, 0x61, 0x63,
+  0x65, 0x6e, 0x63, 0x79, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x3b, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69,
+  0x6d, 0x75, 0x6d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20,
+  0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x62, 0x69,
+  0x74, 0x6d, 0x61, 0x70, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+  0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x20, 0x2a, 0x20,
+  0x6d, 0x61, 0x69, 0x6e, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65,
+  0x74, 0x20, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x2d, 0x61, 0x29, 0x2e,
+  0x20, 0x41, 0x20, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x30, 0x0a, 0x20, 0x2a, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61,
+  0x70, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x44, 0x45, 0x46, 0x41, 0x55, 0x4c, 0x54, 0x5f, 0x42, 0x49,
+  0x54, 0x4d, 0x41, 0x50, 0x5f, 0x42, 0x55, 0x44, 0x47, 0x45, 0x54, 0x20,
+  0x28, 0x36, 0x34, 0x4c, 0x20, 0x2a, 0x20, 0x31, 0x30, 0x32, 0x34, 0x20,
+  0x2a, 0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x0a, 0x65, 0x78, 0x74, 0x65,
+  0x72, 0x6e, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x61, 0x64, 0x6a, 0x61,
+  0x63, 0x65, 0x6e, 0x63, 0x79, 0x5f, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70,
+  0x5f, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a,
+  0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x66, 0x61, 0x6c,
+  0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x6f, 0x75,
+  0x72, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65,
+  0x74, 0x2e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74,
+  0x72, 0x75, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74,
+  0x20, 0x68, 0x61, 0x73, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x73,
+  0x20, 0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61,
+  0x70, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x74, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x62,
+  0x75, 0x64, 0x67, 0x65, 0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62,
+  0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 0x62, 0x75, 0x69,
+  0x6c, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x6e, 0x20,
+  0x61, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x66, 0x69, 0x74, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f,
+  0x6f, 0x6c, 0x20, 0x6d, 0x61, 0x79, 0x42, 0x65, 0x41, 0x64, 0x6a, 0x61,
+  0x63, 0x65, 0x6e, 0x74, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
+  0x43, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65,
+  0x70, 0x6f, 0x72, 0x74, 0x45, 0x64, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6e, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x6f,
+  0x75, 0x72, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x61, 0x72, 0x67,
+  0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x6d,
+  0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x64, 0x64, 0x41, 0x64, 0x6a, 0x61,
+  0x63, 0x65, 0x6e, 0x63, 0x79, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x41, 0x64, 0x6a, 0x61,
+  0x63, 0x65, 0x6e, 0x63, 0x79, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65,
+  0x6e, 0x63, 0x79, 0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x28, 0x47, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x29, 0x3b,
+  0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20,
+  0x49, 0x4e, 0x43, 0x5f, 0x41, 0x44, 0x4a, 0x41, 0x43, 0x45, 0x4e, 0x43,
+  0x59, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int adjacency_h_len = 3991;
+
+unsigned char candidates_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20,
+  0x43, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20, 0x46, 0x69,
+  0x6c, 0x74, 0x65, 0x72, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x0a,
+  0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x0a, 0x0a, 0x20, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20,
+  0x49, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x0a, 0x20,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76, 0x65,
+  0x72, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2c, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+  0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65,
+  0x64, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x3a,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+  0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72,
+  0x75, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+  0x63, 0x6b, 0x65, 0x64, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x75,
+  0x6d, 0x6d, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x0a, 0x20,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x28,
+  0x73, 0x65, 0x65, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x75, 0x6d, 0x6d,
+  0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x2e, 0x68, 0x29, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f,
+  0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69,
+  0x6e, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x69, 0x6e, 0x67, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x4f, 0x6e,
+  0x20, 0x78, 0x38, 0x36, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x6f, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6d, 0x6d,
+  0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x65, 0x64, 0x20, 0x33, 0x32, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x41, 0x56, 0x58, 0x32, 0x0a, 0x20, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x6f, 0x72, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x31, 0x36, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x74,
+  0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x0a, 0x20, 0x20, 0x53, 0x53, 0x45, 0x32, 0x20, 0x69, 0x6e, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x74, 0x68,
+  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2e, 0x20, 0x4f, 0x6e, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x6f, 0x72, 0x73, 0x20, 0x61, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x72,
+  0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65,
+  0x64, 0x2e, 0x0a, 0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a, 0x2f, 0x0a, 0x0a,
+  0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x49, 0x4e, 0x43, 0x5f,
+  0x43, 0x41, 0x4e, 0x44, 0x49, 0x44, 0x41, 0x54, 0x45, 0x53, 0x5f, 0x48,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x4e, 0x43,
+  0x5f, 0x43, 0x41, 0x4e, 0x44, 0x49, 0x44, 0x41, 0x54, 0x45, 0x53, 0x5f,
+  0x48, 0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20,
+  0x22, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a,
+  0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x2e, 0x68, 0x22, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6c, 0x74,
+  0x65, 0x72, 0x4e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x68, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20,
+  0x2a, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74, 0x65, 0x20,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x69, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x46, 0x49, 0x4c, 0x54, 0x45,
+  0x52, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x20, 0x31, 0x32, 0x38, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x50, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x4e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x72,
+  0x6b, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x74, 0x65, 0x73, 0x74, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x45, 0x56, 0x45, 0x52, 0x59, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x20, 0x28,
+  0x41, 0x4e, 0x59, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x0a, 0x0a, 0x2f, 0x2a,
+  0x20, 0x54, 0x65, 0x73, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6e,
+  0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x20, 0x2b, 0x20, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x42,
+  0x4c, 0x4f, 0x43, 0x4b, 0x20, 0x2d, 0x20, 0x31, 0x20, 0x28, 0x6f, 0x72,
+  0x20, 0x74, 0x6f, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+  0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x61, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x0a,
+  0x20, 0x2a, 0x20, 0x61, 0x73, 0x63, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x20, 0x52, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69,
+  0x64, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x41, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20,
+  0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x20, 0x68, 0x6f, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75,
+  0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x65, 0x64, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x28, 0x6f,
+  0x72, 0x0a, 0x20, 0x2a, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
+  0x30, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x69, 0x73, 0x20,
+  0x41, 0x4e, 0x59, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x6e, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x6d, 0x61,
+  0x72, 0x6b, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x45, 0x56, 0x45,
+  0x52, 0x59, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x29, 0x2c, 0x20, 0x69, 0x74,
+  0x73, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73,
+  0x74, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6d, 0x20, 0x6f,
+  0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x73,
+  0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+  0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x2e, 0x0a, 0x20, 0x2a, 0x20,
+  0x44, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x73, 0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74,
+  0x20, 0x32, 0x35, 0x35, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x68, 0x69, 0x67, 0x68,
+  0x0a, 0x20, 0x2a, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x74,
+  0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x20, 0x72, 0x65, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x3b,
+  0x20, 0x69, 0x74, 0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x72, 0x65,
+  0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x61, 0x63,
+  0x63, 0x65, 0x70, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x74,
+  0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x4e, 0x6f, 0x64, 0x65, 0x73,
+  0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x2c, 0x20, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x20, 0x6d,
+  0x61, 0x72, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x67, 0x72, 0x65, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x63, 0x61, 0x6e, 0x64, 0x69,
+  0x64, 0x61, 0x74, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x43,
+  0x41, 0x4e, 0x44, 0x49, 0x44, 0x41, 0x54, 0x45, 0x53, 0x5f, 0x48, 0x20,
+  0x2a, 0x2f, 0x0a, 0x00
 };
-unsigned int globals_h_len = 3169;
+unsigned int candidates_h_len = 2067;
 
 unsigned char debug_h[] = {
   0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
@@ -463,83 +1081,551 @@ unsigned char graph_h[] = {
   0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x49, 0x6e, 0x74, 0x41,
   0x72, 0x72, 0x61, 0x79, 0x20, 0x68, 0x6f, 0x6c, 0x65, 0x73, 0x3b, 0x0a,
   0x7d, 0x20, 0x45, 0x64, 0x67, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x3b,
-  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x0a, 0x20, 0x2a, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x44,
-  0x61, 0x74, 0x61, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
-  0x65, 0x20, 0x2b, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x20, 0x2a, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
-  0x3d, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66,
-  0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x47, 0x72, 0x61, 0x70,
-  0x68, 0x20, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x64, 0x65,
-  0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x45, 0x64, 0x67, 0x65, 0x41, 0x72, 0x72, 0x61,
-  0x79, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
-  0x72, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x64, 0x75, 0x6d,
-  0x6d, 0x79, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x27, 0x73, 0x20,
-  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2f, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20,
-  0x61, 0x72, 0x72, 0x61, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a,
-  0x20, 0x44, 0x6f, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x75, 0x73, 0x65, 0x20,
-  0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20,
-  0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x62, 0x65, 0x63, 0x61,
-  0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65, 0x6d,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x6d, 0x61, 0x79, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
-  0x64, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x6f, 0x75, 0x73,
-  0x6c, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
-  0x72, 0x61, 0x79, 0x2e, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64,
-  0x20, 0x75, 0x73, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x73,
-  0x69, 0x7a, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2a, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65,
-  0x2e, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65,
-  0x20, 0x65, 0x71, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x62,
-  0x65, 0x6c, 0x6f, 0x77, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x76,
-  0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65,
-  0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
-  0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
-  0x74, 0x75, 0x72, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x6e, 0x6f,
-  0x64, 0x65, 0x73, 0x20, 0x2b, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x68,
-  0x6f, 0x6c, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20,
-  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
-  0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x2b,
-  0x20, 0x65, 0x64, 0x67, 0x65, 0x5f, 0x68, 0x6f, 0x6c, 0x65, 0x73, 0x2e,
-  0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73,
-  0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a,
-  0x20, 0x49, 0x6e, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x2c, 0x20, 0x65,
-  0x61, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
-  0x69, 0x72, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x73,
-  0x69, 0x7a, 0x65, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x6f, 0x66,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x72,
+  0x6b, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x79, 0x20,
+  0x6f, 0x66, 0x20, 0x61, 0x20, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x48, 0x4f, 0x4c, 0x45, 0x5f, 0x4d, 0x41, 0x52,
+  0x4b, 0x20, 0x32, 0x35, 0x35, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x4e, 0x65,
+  0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x68, 0x6f, 0x6f, 0x64, 0x20,
+  0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x73, 0x2e, 0x20,
+  0x42, 0x69, 0x74, 0x20, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52,
+  0x45, 0x5f, 0x42, 0x49, 0x54, 0x28, 0x74, 0x72, 0x75, 0x65, 0x2c, 0x20,
+  0x65, 0x2c, 0x20, 0x6e, 0x29, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x6f, 0x75, 0x74,
+  0x67, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x65, 0x20, 0x77,
+  0x68, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x6e, 0x2e, 0x0a,
+  0x20, 0x2a, 0x20, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45,
+  0x5f, 0x42, 0x49, 0x54, 0x28, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x2c, 0x20,
+  0x65, 0x2c, 0x20, 0x6e, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e,
+  0x63, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x44,
+  0x61, 0x73, 0x68, 0x65, 0x64, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20,
+  0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x67, 0x72, 0x65, 0x79, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x72, 0x65,
+  0x79, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6f,
+  0x66, 0x0a, 0x20, 0x2a, 0x20, 0x64, 0x61, 0x73, 0x68, 0x65, 0x64, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x65, 0x61, 0x6b, 0x65, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x20,
+  0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x65, 0x72, 0x73, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x2a, 0x20,
+  0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x4c, 0x48, 0x53, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x68, 0x61, 0x73, 0x53, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75,
+  0x72, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52, 0x45,
+  0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x28, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x20,
+  0x28, 0x28, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x44,
+  0x41, 0x53, 0x48, 0x45, 0x44, 0x20, 0x3f, 0x20, 0x47, 0x52, 0x45, 0x59,
+  0x20, 0x3a, 0x20, 0x28, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x29, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x49, 0x47, 0x4e, 0x41,
+  0x54, 0x55, 0x52, 0x45, 0x5f, 0x42, 0x49, 0x54, 0x28, 0x6f, 0x75, 0x74,
+  0x67, 0x6f, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x65, 0x64, 0x67, 0x65, 0x5f,
+  0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x6d,
+  0x61, 0x72, 0x6b, 0x29, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x28, 0x31,
+  0x55, 0x4c, 0x4c, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x28, 0x28, 0x6f, 0x75,
+  0x74, 0x67, 0x6f, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x20,
+  0x3a, 0x20, 0x33, 0x32, 0x29, 0x20, 0x2b, 0x20, 0x53, 0x49, 0x47, 0x4e,
+  0x41, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x28, 0x65,
+  0x64, 0x67, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x20, 0x2a, 0x20,
+  0x35, 0x20, 0x2b, 0x20, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x49, 0x47, 0x4e, 0x41,
+  0x54, 0x55, 0x52, 0x45, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x28, 0x6e, 0x6f,
+  0x64, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x29, 0x29, 0x0a, 0x2f,
+  0x2a, 0x20, 0x41, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72,
+  0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x75,
+  0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x65, 0x64, 0x67, 0x65,
+  0x73, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0x65, 0x64,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x53, 0x54, 0x41, 0x4c, 0x45, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41,
+  0x54, 0x55, 0x52, 0x45, 0x20, 0x28, 0x31, 0x55, 0x4c, 0x4c, 0x20, 0x3c,
+  0x3c, 0x20, 0x36, 0x33, 0x29, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x50, 0x61,
+  0x63, 0x6b, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x65, 0x64,
+  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x61, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x0a, 0x20, 0x2a, 0x20, 0x69, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65,
+  0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x6c, 0x69, 0x6b, 0x65,
   0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x72,
-  0x72, 0x61, 0x79, 0x20, 0x69, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65,
-  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x61, 0x20, 0x64, 0x75,
-  0x6d, 0x6d, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x28, 0x61, 0x20,
-  0x68, 0x6f, 0x6c, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
-  0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f,
-  0x76, 0x61, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64,
-  0x65, 0x29, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c,
-  0x69, 0x64, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
-  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
-  0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20,
-  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x65, 0x64,
-  0x67, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20,
-  0x2f, 0x2a, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65,
-  0x73, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x64,
-  0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64,
-  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x61,
-  0x73, 0x74, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2e, 0x20, 0x2a,
-  0x2f, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
-  0x52, 0x6f, 0x6f, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x2a, 0x72,
+  0x72, 0x61, 0x79, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x79, 0x20, 0x63, 0x61, 0x6e, 0x0a, 0x20, 0x2a, 0x20,
+  0x62, 0x65, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x6d,
+  0x61, 0x6e, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x74,
+  0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x66,
+  0x69, 0x6c, 0x74, 0x65, 0x72, 0x4e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x28,
+  0x73, 0x65, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x64, 0x69, 0x64, 0x61, 0x74,
+  0x65, 0x73, 0x2e, 0x68, 0x29, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x61,
+  0x72, 0x6b, 0x73, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x27, 0x73, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x6f,
+  0x72, 0x20, 0x48, 0x4f, 0x4c, 0x45, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x20,
+  0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x6f,
+  0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x0a,
+  0x20, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x65, 0x65, 0x6e, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 0x0a, 0x20, 0x2a,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x2c, 0x20,
+  0x6f, 0x75, 0x74, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x2d,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x20,
+  0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x2c, 0x20, 0x73, 0x61, 0x74,
+  0x75, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x32, 0x35,
+  0x35, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x73, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62,
+  0x6f, 0x75, 0x72, 0x68, 0x6f, 0x6f, 0x64, 0x20, 0x73, 0x69, 0x67, 0x6e,
+  0x61, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x53, 0x54,
+  0x41, 0x4c, 0x45, 0x5f, 0x53, 0x49, 0x47, 0x4e, 0x41, 0x54, 0x55, 0x52,
+  0x45, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x73, 0x2c, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20,
+  0x73, 0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74,
+  0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x44, 0x5f, 0x4c, 0x45, 0x4e,
+  0x47, 0x54, 0x48, 0x53, 0x20, 0x2d, 0x20, 0x31, 0x2c, 0x0a, 0x20, 0x2a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x6f,
+  0x6f, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x2c, 0x20, 0x61, 0x73, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x27, 0x73, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+  0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x4e, 0x6f, 0x64,
+  0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x70, 0x61,
+  0x63, 0x69, 0x74, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+  0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+  0x6d, 0x61, 0x72, 0x6b, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e,
+  0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+  0x2a, 0x69, 0x6e, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+  0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6f, 0x75, 0x74, 0x64, 0x65, 0x67,
+  0x72, 0x65, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+  0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x2a, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75,
+  0x72, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x62,
+  0x6f, 0x6f, 0x6c, 0x20, 0x2a, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x3b, 0x0a,
+  0x7d, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72,
+  0x69, 0x65, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63, 0x68,
+  0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x61,
+  0x63, 0x68, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x0a, 0x20, 0x2a, 0x20,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73,
+  0x2e, 0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+  0x45, 0x44, 0x5f, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x53, 0x20, 0x2d,
+  0x20, 0x31, 0x20, 0x6f, 0x72, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x6f, 0x72,
+  0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x2a, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72,
+  0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x4c, 0x48, 0x53, 0x20, 0x69, 0x74, 0x65, 0x6d,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6b, 0x69,
+  0x6e, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x6d, 0x61,
+  0x72, 0x6b, 0x73, 0x5b, 0x48, 0x4f, 0x53, 0x54, 0x5f, 0x4d, 0x41, 0x52,
+  0x4b, 0x53, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x5b, 0x48,
+  0x4f, 0x53, 0x54, 0x5f, 0x4d, 0x41, 0x52, 0x4b, 0x53, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f,
+  0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x73, 0x5b, 0x43, 0x4f, 0x55, 0x4e,
+  0x54, 0x45, 0x44, 0x5f, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48, 0x53, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x64, 0x67,
+  0x65, 0x5f, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x73, 0x5b, 0x43, 0x4f,
+  0x55, 0x4e, 0x54, 0x45, 0x44, 0x5f, 0x4c, 0x45, 0x4e, 0x47, 0x54, 0x48,
+  0x53, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72,
   0x6f, 0x6f, 0x74, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3b, 0x0a, 0x7d,
-  0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
+  0x20, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e,
+  0x74, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x49, 0x6e, 0x63, 0x72,
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74,
+  0x6f, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x72, 0x75, 0x6c,
+  0x65, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x73, 0x20, 0x69, 0x74,
+  0x73, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x2a, 0x20,
+  0x66, 0x61, 0x69, 0x6c, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63,
+  0x65, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 0x6e, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x4c, 0x48, 0x53, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65,
+  0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65,
+  0x73, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x53, 0x69, 0x6e, 0x63,
+  0x65, 0x29, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72,
+  0x6e, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x65,
+  0x70, 0x6f, 0x63, 0x68, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2e, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x73, 0x5b, 0x6d, 0x5d, 0x20, 0x68, 0x6f, 0x6c,
+  0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a,
+  0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x6d, 0x61, 0x72, 0x6b, 0x20, 0x6d, 0x20, 0x69, 0x6e, 0x20, 0x6e, 0x6f,
+  0x20, 0x70, 0x61, 0x72, 0x74, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69, 0x5d, 0x20,
+  0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x20, 0x69, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 0x61, 0x70,
+  0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x45, 0x64, 0x67, 0x65, 0x4d,
+  0x61, 0x72, 0x6b, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x49, 0x6e, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x73, 0x5b, 0x48, 0x4f, 0x53, 0x54, 0x5f, 0x4d, 0x41,
+  0x52, 0x4b, 0x53, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x3b, 0x0a, 0x7d, 0x20, 0x45, 0x64, 0x67, 0x65,
+  0x4d, 0x61, 0x72, 0x6b, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a,
+  0x20, 0x2a, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x44, 0x61, 0x74,
+  0x61, 0x20, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+  0x2b, 0x20, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a,
+  0x20, 0x2a, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20,
+  0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x41, 0x72,
+  0x72, 0x61, 0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x45, 0x64, 0x67, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x2f, 0x2a,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x64, 0x75, 0x6d, 0x6d, 0x79,
+  0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x27, 0x73, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x73, 0x2f, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x44,
+  0x6f, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x73, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x69, 0x74,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x6f, 0x75, 0x73, 0x6c, 0x79,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x2e, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x75,
+  0x73, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65,
+  0x71, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x62, 0x65, 0x6c,
+  0x6f, 0x77, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74,
+  0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+  0x72, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x2b, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x68, 0x6f, 0x6c,
+  0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a, 0x65, 0x2e, 0x20, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2a, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f,
+  0x6f, 0x66, 0x5f, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x2b, 0x20, 0x65,
+  0x64, 0x67, 0x65, 0x5f, 0x68, 0x6f, 0x6c, 0x65, 0x73, 0x2e, 0x73, 0x69,
+  0x7a, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2e, 0x73,
+  0x69, 0x7a, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x49,
+  0x6e, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x2c, 0x20, 0x65, 0x61, 0x63,
+  0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x73, 0x69, 0x7a,
+  0x65, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x20, 0x69, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x61, 0x20, 0x64, 0x75, 0x6d, 0x6d,
+  0x79, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x28, 0x61, 0x20, 0x68, 0x6f,
+  0x6c, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x61,
+  0x6c, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x29,
+  0x2c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f,
+  0x6f, 0x66, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6f, 0x66, 0x5f, 0x65, 0x64, 0x67, 0x65,
+  0x73, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x4b, 0x65,
+  0x70, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x61, 0x74,
+  0x65, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x4e,
+  0x6f, 0x64, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74,
+  0x45, 0x64, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x75, 0x6d, 0x6d, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x73, 0x75,
+  0x6d, 0x6d, 0x61, 0x72, 0x69, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+  0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x2f, 0x2a, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x5f, 0x65,
+  0x70, 0x6f, 0x63, 0x68, 0x73, 0x5b, 0x63, 0x5d, 0x20, 0x69, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x65, 0x70, 0x6f, 0x63,
+  0x68, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x63,
+  0x20, 0x77, 0x61, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x6c,
+  0x61, 0x73, 0x74, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x72,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x64, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x69,
+  0x6e, 0x63, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73,
+  0x75, 0x63, 0x68, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2a, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6c, 0x61, 0x73,
+  0x74, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x72, 0x65, 0x6d,
+  0x6f, 0x76, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x64, 0x2e, 0x20, 0x4b, 0x65, 0x70, 0x74, 0x20, 0x75, 0x70,
+  0x20, 0x74, 0x6f, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20, 0x62, 0x79, 0x20,
+  0x72, 0x65, 0x70, 0x6f, 0x72, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x6c, 0x69,
+  0x6e, 0x67, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x5f, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x73, 0x5b, 0x4e,
+  0x4f, 0x44, 0x45, 0x5f, 0x43, 0x4c, 0x41, 0x53, 0x53, 0x45, 0x53, 0x5d,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x64, 0x67,
+  0x65, 0x73, 0x20, 0x62, 0x79, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x20, 0x61, 0x6e, 0x20, 0x4c, 0x48, 0x53, 0x20, 0x65, 0x64, 0x67,
+  0x65, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x2e, 0x20,
+  0x4e, 0x55, 0x4c, 0x4c, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2a, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x75,
+  0x73, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x45,
+  0x64, 0x67, 0x65, 0x4d, 0x61, 0x72, 0x6b, 0x49, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x2a, 0x65, 0x64, 0x67, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x5f,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x2f,
+  0x2a, 0x20, 0x53, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x76, 0x69, 0x65,
+  0x77, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x27, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x69, 0x64, 0x65, 0x6e, 0x74,
+  0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2a, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x53,
+  0x65, 0x65, 0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79,
+  0x2e, 0x68, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x20, 0x53, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x41,
+  0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x2a, 0x73, 0x6f,
+  0x72, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e,
+  0x63, 0x79, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x42,
+  0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x70, 0x61, 0x69,
+  0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65,
+  0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2e, 0x20, 0x4e, 0x55,
+  0x4c, 0x4c, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x6f, 0x72, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6f,
+  0x6f, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x2e, 0x20, 0x53, 0x65, 0x65,
+  0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x2e, 0x68,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x20, 0x41, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79,
+  0x42, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x20, 0x2a, 0x61, 0x64, 0x6a, 0x61,
+  0x63, 0x65, 0x6e, 0x63, 0x79, 0x5f, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20,
+  0x52, 0x6f, 0x6f, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x72,
+  0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x61, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20,
+  0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20,
+  0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x52, 0x6f, 0x6f,
+  0x74, 0x4e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x2a, 0x72, 0x6f, 0x6f, 0x74,
+  0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3b, 0x0a, 0x7d, 0x20, 0x47, 0x72,
+  0x61, 0x70, 0x68, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x49, 0x66, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x73, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6f,
+  0x72, 0x0a, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61,
+  0x63, 0x68, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x73,
+  0x65, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x72, 0x6f, 0x6f,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x6f, 0x72, 0x20,
+  0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x2a,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2c, 0x20, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x73, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20, 0x77, 0x68, 0x65,
+  0x6e, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x2e,
+  0x20, 0x53, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x6f,
+  0x72, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x61, 0x6c, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20,
+  0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
+  0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x28, 0x2a, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x5f, 0x68, 0x6f, 0x6f, 0x6b, 0x29, 0x28, 0x47, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x0a, 0x2f,
+  0x2a, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x43, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63,
+  0x68, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x61, 0x64,
+  0x64, 0x65, 0x64, 0x2c, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x6f, 0x72, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2e,
+  0x20, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x20, 0x73, 0x75, 0x6d, 0x6d,
+  0x61, 0x72, 0x79, 0x2c, 0x20, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64,
+  0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x65, 0x64,
+  0x0a, 0x20, 0x2a, 0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63,
+  0x79, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x73, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x5f, 0x68, 0x6f, 0x6f, 0x6b, 0x2e, 0x20, 0x43,
+  0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6d, 0x6f, 0x64,
+  0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x0a, 0x20, 0x2a, 0x20,
+  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x6d, 0x75, 0x73,
+  0x74, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69,
+  0x74, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x73, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6f,
+  0x72, 0x74, 0x4e, 0x6f, 0x64, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65,
+  0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x65,
+  0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x79, 0x20, 0x75, 0x6e, 0x64, 0x6f,
+  0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65,
+  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x6e, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20,
+  0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x61,
+  0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x28, 0x61, 0x64, 0x64, 0x65, 0x64,
+  0x20, 0x73, 0x65, 0x74, 0x29, 0x20, 0x6f, 0x72, 0x20, 0x72, 0x65, 0x6d,
+  0x6f, 0x76, 0x65, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x69, 0x74, 0x2e, 0x20, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x61, 0x64, 0x6a, 0x61, 0x63, 0x65, 0x6e, 0x63, 0x79, 0x0a, 0x20,
+  0x2a, 0x20, 0x62, 0x69, 0x74, 0x6d, 0x61, 0x70, 0x2e, 0x20, 0x2a, 0x2f,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x72, 0x74,
+  0x45, 0x64, 0x67, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x28, 0x47,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x48, 0x6f,
+  0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x2c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x61, 0x64, 0x64, 0x65,
+  0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
+  0x69, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x27, 0x73, 0x20, 0x65, 0x64, 0x67, 0x65,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x0a, 0x20,
+  0x2a, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6d, 0x75, 0x73, 0x74,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x41, 0x4e, 0x59, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69,
+  0x73, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x63, 0x61, 0x6c,
+  0x6c, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x61, 0x72, 0x72,
+  0x61, 0x79, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x76,
+  0x61, 0x6c, 0x69, 0x64, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x73, 0x20,
+  0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
+  0x49, 0x6e, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x2a, 0x67, 0x65,
+  0x74, 0x4d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x45, 0x64, 0x67, 0x65, 0x73,
+  0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x20,
+  0x6d, 0x61, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x52,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+  0x69, 0x66, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x6f, 0x6d, 0x65,
+  0x20, 0x62, 0x69, 0x74, 0x20, 0x63, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69,
+  0x6e, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x2c, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x63, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x0a, 0x20, 0x2a, 0x20, 0x68, 0x61, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x64, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x5f, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x68,
+  0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62,
+  0x6f, 0x6f, 0x6c, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x43,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x53, 0x69, 0x6e, 0x63, 0x65, 0x28,
+  0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x2c, 0x20,
+  0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+  0x67, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x2f,
+  0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x72,
+  0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+  0x65, 0x64, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75,
+  0x72, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+  0x68, 0x61, 0x73, 0x53, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65,
+  0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x71,
+  0x75, 0x69, 0x72, 0x65, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
   0x54, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
   0x73, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20,
   0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68,
@@ -773,17 +1859,98 @@ unsigned char graph_h[] = {
   0x67, 0x65, 0x74, 0x4f, 0x75, 0x74, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
   0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70,
   0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x69,
+  0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x20, 0x61, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x47, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x30, 0x2c,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x2c, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x6e,
+  0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x70, 0x65, 0x72,
+  0x20, 0x6f, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x6f, 0x72, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78,
+  0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3b, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x2c, 0x20, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x61,
+  0x72, 0x67, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x69,
+  0x6e, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x73, 0x0a, 0x20, 0x2a, 0x20,
+  0x6f, 0x6e, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74,
+  0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x69,
   0x6e, 0x74, 0x47, 0x72, 0x61, 0x70, 0x68, 0x28, 0x47, 0x72, 0x61, 0x70,
   0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x46, 0x49,
   0x4c, 0x45, 0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x76,
   0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x47, 0x72, 0x61, 0x70,
   0x68, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61,
-  0x70, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66,
-  0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x47, 0x52, 0x41, 0x50,
-  0x48, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a
+  0x70, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x2a,
+  0x20, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x2d, 0x53, 0x65,
+  0x65, 0x64, 0x65, 0x64, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x0a, 0x20, 0x2a, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x20, 0x2a, 0x2f, 0x0a, 0x2f, 0x2a, 0x20,
+  0x55, 0x73, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x66,
+  0x6c, 0x61, 0x67, 0x20, 0x2d, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x2e, 0x20, 0x52, 0x75, 0x6c, 0x65, 0x20, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x70, 0x72,
+  0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x61,
+  0x64, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x2a, 0x20, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x72,
+  0x75, 0x6c, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x74, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x4c, 0x48, 0x53, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x74, 0x6f, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x6f, 0x72, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62,
+  0x6f, 0x75, 0x72, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x0a, 0x20, 0x2a, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x4f,
+  0x6e, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x4d, 0x41, 0x58, 0x5f, 0x54, 0x4f, 0x55, 0x43, 0x48, 0x45,
+  0x44, 0x5f, 0x4e, 0x4f, 0x44, 0x45, 0x53, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c,
+  0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x6b, 0x65, 0x70, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x4d, 0x41, 0x58, 0x5f, 0x54, 0x4f, 0x55,
+  0x43, 0x48, 0x45, 0x44, 0x5f, 0x4e, 0x4f, 0x44, 0x45, 0x53, 0x20, 0x36,
+  0x34, 0x0a, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x74, 0x6f, 0x75, 0x63, 0x68, 0x65, 0x64, 0x5f, 0x6e, 0x6f,
+  0x64, 0x65, 0x73, 0x5b, 0x4d, 0x41, 0x58, 0x5f, 0x54, 0x4f, 0x55, 0x43,
+  0x48, 0x45, 0x44, 0x5f, 0x4e, 0x4f, 0x44, 0x45, 0x53, 0x5d, 0x3b, 0x0a,
+  0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x6f, 0x75, 0x63, 0x68, 0x65, 0x64, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x54, 0x6f, 0x75, 0x63, 0x68, 0x65,
+  0x64, 0x4e, 0x6f, 0x64, 0x65, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+  0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x64, 0x64, 0x54, 0x6f,
+  0x75, 0x63, 0x68, 0x65, 0x64, 0x4e, 0x6f, 0x64, 0x65, 0x28, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x0a, 0x23,
+  0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43,
+  0x5f, 0x47, 0x52, 0x41, 0x50, 0x48, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a,
+  0x00
 };
-unsigned int graph_h_len = 4879;
+unsigned int graph_h_len = 11460;
 
 
 unsigned char graphStacks_h[] = {
@@ -1079,14 +2246,39 @@ unsigned char graphStacks_h[] = {
   0x5f, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
   0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74,
   0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x5f, 0x63, 0x6f, 0x70, 0x79, 0x5f,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43,
-  0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x65, 0x6d,
-  0x6f, 0x72, 0x79, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f, 0x66, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x67,
-  0x72, 0x61, 0x70, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x75, 0x73,
-  0x68, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x73, 0x74, 0x61, 0x63,
-  0x6b, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x61, 0x20, 0x6c, 0x61, 0x72,
+  0x67, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20,
+  0x63, 0x6f, 0x70, 0x79, 0x47, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x30,
+  0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x2c, 0x0a, 0x20, 0x2a, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x70, 0x65,
+  0x72, 0x20, 0x6f, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x73, 0x73, 0x6f, 0x72, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65,
+  0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f,
+  0x70, 0x79, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3b, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x61, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x63, 0x6f, 0x70,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x69,
+  0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61,
+  0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+  0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x73, 0x27, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20,
+  0x6f, 0x6e, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63,
   0x6f, 0x70, 0x79, 0x47, 0x72, 0x61, 0x70, 0x68, 0x28, 0x47, 0x72, 0x61,
   0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x29, 0x3b, 0x0a,
   0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20,
@@ -1118,288 +2310,221 @@ unsigned char graphStacks_h[] = {
   0x4e, 0x43, 0x5f, 0x47, 0x52, 0x41, 0x50, 0x48, 0x5f, 0x53, 0x54, 0x41,
   0x43, 0x4b, 0x53, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
 };
-unsigned int graphStacks_h_len = 3957;
+unsigned int graphStacks_h_len = 4257;
 
 
 unsigned char hostParser_h[] = {
-  0x2f, 0x2a, 0x20, 0x41, 0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x70,
-  0x61, 0x72, 0x73, 0x65, 0x72, 0x2c, 0x20, 0x6d, 0x61, 0x64, 0x65, 0x20,
-  0x62, 0x79, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e,
-  0x20, 0x33, 0x2e, 0x30, 0x2e, 0x32, 0x2e, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-  0x0a, 0x2f, 0x2a, 0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x59, 0x61, 0x63, 0x63, 0x2d, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x70, 0x61,
-  0x72, 0x73, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x43, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x20, 0x28, 0x43, 0x29, 0x20, 0x31, 0x39, 0x38, 0x34, 0x2c, 0x20, 0x31,
-  0x39, 0x38, 0x39, 0x2d, 0x31, 0x39, 0x39, 0x30, 0x2c, 0x20, 0x32, 0x30,
-  0x30, 0x30, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x20, 0x46, 0x72, 0x65, 0x65,
-  0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x46, 0x6f,
-  0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x49, 0x6e,
-  0x63, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
-  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x66,
-  0x72, 0x65, 0x65, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x3a, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x72, 0x65,
-  0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x69,
-  0x74, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64,
-  0x69, 0x66, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x74, 0x20, 0x75, 0x6e,
-  0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d,
-  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55,
-  0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62,
-  0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x61, 0x73, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x65, 0x64,
-  0x20, 0x62, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46,
-  0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
-  0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
-  0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x20, 0x33, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x6f, 0x72,
-  0x0a, 0x20, 0x20, 0x20, 0x28, 0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x72,
-  0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x61, 0x6e, 0x79,
-  0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69,
-  0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73,
-  0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x64, 0x20,
-  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x70, 0x65, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c,
-  0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6c, 0x2c, 0x0a,
-  0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x20, 0x57, 0x49, 0x54, 0x48, 0x4f,
-  0x55, 0x54, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41,
-  0x4e, 0x54, 0x59, 0x3b, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74,
-  0x20, 0x65, 0x76, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6d,
-  0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x77, 0x61, 0x72, 0x72, 0x61, 0x6e,
-  0x74, 0x79, 0x20, 0x6f, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x4d, 0x45, 0x52,
-  0x43, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59,
-  0x20, 0x6f, 0x72, 0x20, 0x46, 0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20,
-  0x46, 0x4f, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52, 0x54, 0x49, 0x43,
-  0x55, 0x4c, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f, 0x53, 0x45,
-  0x2e, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61,
-  0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63,
-  0x65, 0x6e, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x72,
-  0x65, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6c, 0x73, 0x2e, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x59, 0x6f, 0x75, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c,
-  0x64, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69,
-  0x76, 0x65, 0x64, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x6f,
-  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x65,
-  0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63,
-  0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x61, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x2e,
-  0x20, 0x20, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x2c, 0x20, 0x73, 0x65,
-  0x65, 0x20, 0x3c, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77,
-  0x77, 0x2e, 0x67, 0x6e, 0x75, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x73, 0x2f, 0x3e, 0x2e, 0x20, 0x20, 0x2a,
-  0x2f, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x41, 0x73, 0x20, 0x61, 0x20, 0x73,
-  0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6d, 0x61,
-  0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6c,
-  0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x74,
-  0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6f, 0x72, 0x20,
-  0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42,
-  0x69, 0x73, 0x6f, 0x6e, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
-  0x73, 0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20,
-  0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x0a, 0x20, 0x20,
-  0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73,
-  0x20, 0x6f, 0x66, 0x20, 0x79, 0x6f, 0x75, 0x72, 0x20, 0x63, 0x68, 0x6f,
-  0x69, 0x63, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
-  0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x6f, 0x72,
-  0x6b, 0x20, 0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x69, 0x74, 0x73, 0x65,
-  0x6c, 0x66, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x70, 0x61, 0x72, 0x73,
-  0x65, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
-  0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-  0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x61,
-  0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x76, 0x65,
-  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x6f,
-  0x66, 0x0a, 0x20, 0x20, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61,
-  0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f,
-  0x6e, 0x2e, 0x20, 0x20, 0x41, 0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74,
-  0x69, 0x76, 0x65, 0x6c, 0x79, 0x2c, 0x20, 0x69, 0x66, 0x20, 0x79, 0x6f,
-  0x75, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x79, 0x20, 0x6f, 0x72, 0x20,
-  0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
-  0x65, 0x72, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f, 0x6e, 0x20,
-  0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x2c, 0x20, 0x79, 0x6f, 0x75, 0x20,
-  0x6d, 0x61, 0x79, 0x20, 0x28, 0x61, 0x74, 0x20, 0x79, 0x6f, 0x75, 0x72,
-  0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x72, 0x65, 0x6d,
-  0x6f, 0x76, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a, 0x20, 0x20, 0x20,
-  0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x63, 0x65,
-  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
-  0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f, 0x6e,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73,
-  0x75, 0x6c, 0x74, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x42, 0x69,
-  0x73, 0x6f, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66,
-  0x69, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x20, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6e, 0x64, 0x65,
-  0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x47, 0x65,
-  0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63,
-  0x0a, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x20,
-  0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x65, 0x78, 0x63,
-  0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x54, 0x68, 0x69, 0x73, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c,
-  0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77,
-  0x61, 0x73, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x53, 0x6f, 0x66,
-  0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x76,
-  0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32, 0x2e, 0x32, 0x20, 0x6f,
-  0x66, 0x20, 0x42, 0x69, 0x73, 0x6f, 0x6e, 0x2e, 0x20, 0x20, 0x2a, 0x2f,
-  0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x59, 0x59,
-  0x5f, 0x59, 0x59, 0x5f, 0x48, 0x4f, 0x53, 0x54, 0x50, 0x41, 0x52, 0x53,
-  0x45, 0x52, 0x5f, 0x48, 0x5f, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45,
-  0x44, 0x0a, 0x23, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x59,
-  0x59, 0x5f, 0x59, 0x59, 0x5f, 0x48, 0x4f, 0x53, 0x54, 0x50, 0x41, 0x52,
-  0x53, 0x45, 0x52, 0x5f, 0x48, 0x5f, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44,
-  0x45, 0x44, 0x0a, 0x2f, 0x2a, 0x20, 0x44, 0x65, 0x62, 0x75, 0x67, 0x20,
-  0x74, 0x72, 0x61, 0x63, 0x65, 0x73, 0x2e, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-  0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x59, 0x59, 0x44, 0x45,
-  0x42, 0x55, 0x47, 0x0a, 0x23, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x20, 0x59, 0x59, 0x44, 0x45, 0x42, 0x55, 0x47, 0x20, 0x30, 0x0a, 0x23,
-  0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x59, 0x59,
-  0x44, 0x45, 0x42, 0x55, 0x47, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
-  0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x79, 0x64, 0x65, 0x62, 0x75, 0x67,
-  0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2a, 0x20,
-  0x22, 0x25, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
-  0x72, 0x65, 0x73, 0x22, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x2e,
-  0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32,
-  0x34, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50, 0x61, 0x72, 0x73, 0x65,
-  0x72, 0x2e, 0x79, 0x22, 0x20, 0x2f, 0x2a, 0x20, 0x79, 0x61, 0x63, 0x63,
-  0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-  0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67,
-  0x72, 0x61, 0x70, 0x68, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e, 0x63,
-  0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2e,
-  0x68, 0x22, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x79, 0x6c, 0x65, 0x78,
-  0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x6c, 0x69,
-  0x6e, 0x65, 0x20, 0x35, 0x30, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50,
-  0x61, 0x72, 0x73, 0x65, 0x72, 0x2e, 0x68, 0x22, 0x20, 0x2f, 0x2a, 0x20,
-  0x79, 0x61, 0x63, 0x63, 0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20,
-  0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x6f, 0x6b, 0x65,
-  0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-  0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x59, 0x59, 0x54, 0x4f,
-  0x4b, 0x45, 0x4e, 0x54, 0x59, 0x50, 0x45, 0x0a, 0x23, 0x20, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x20, 0x59, 0x59, 0x54, 0x4f, 0x4b, 0x45, 0x4e,
-  0x54, 0x59, 0x50, 0x45, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20,
-  0x79, 0x79, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x74, 0x79, 0x70, 0x65, 0x0a,
-  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x41, 0x52, 0x4b,
-  0x20, 0x3d, 0x20, 0x32, 0x35, 0x38, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x4e, 0x55, 0x4d, 0x20, 0x3d, 0x20, 0x32, 0x35, 0x39, 0x2c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x44, 0x4e, 0x55, 0x4d, 0x20, 0x3d, 0x20, 0x32, 0x36,
-  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x53, 0x54, 0x52, 0x20, 0x3d,
-  0x20, 0x32, 0x36, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x4f,
-  0x44, 0x45, 0x5f, 0x49, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x32, 0x2c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x45, 0x44, 0x47, 0x45, 0x5f, 0x49, 0x44,
-  0x20, 0x3d, 0x20, 0x32, 0x36, 0x33, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x52, 0x4f, 0x4f, 0x54, 0x20, 0x3d, 0x20, 0x32, 0x36, 0x34, 0x2c, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x5f, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x20, 0x3d,
-  0x20, 0x32, 0x36, 0x35, 0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x23, 0x65,
-  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 0x20, 0x2a, 0x2f,
-  0x0a, 0x23, 0x69, 0x66, 0x20, 0x21, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x64, 0x20, 0x59, 0x59, 0x53, 0x54, 0x59, 0x50, 0x45, 0x20, 0x26,
-  0x26, 0x20, 0x21, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x59, 0x59, 0x53, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x53, 0x5f, 0x44,
-  0x45, 0x43, 0x4c, 0x41, 0x52, 0x45, 0x44, 0x0a, 0x74, 0x79, 0x70, 0x65,
-  0x64, 0x65, 0x66, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x59, 0x59,
-  0x53, 0x54, 0x59, 0x50, 0x45, 0x20, 0x59, 0x59, 0x53, 0x54, 0x59, 0x50,
-  0x45, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x59, 0x59, 0x53,
-  0x54, 0x59, 0x50, 0x45, 0x0a, 0x7b, 0x0a, 0x23, 0x6c, 0x69, 0x6e, 0x65,
-  0x20, 0x35, 0x35, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50, 0x61, 0x72,
-  0x73, 0x65, 0x72, 0x2e, 0x79, 0x22, 0x20, 0x2f, 0x2a, 0x20, 0x79, 0x61,
-  0x63, 0x63, 0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20, 0x20, 0x2a,
-  0x2f, 0x0a, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e,
-  0x75, 0x6d, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x76, 0x61, 0x6c,
-  0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x4e, 0x55, 0x4d, 0x20, 0x74, 0x6f,
-  0x6b, 0x65, 0x6e, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x69, 0x6e,
-  0x74, 0x20, 0x64, 0x6e, 0x75, 0x6d, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2a,
-  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x44, 0x4e,
-  0x55, 0x4d, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x2e, 0x20, 0x2a, 0x2f,
-  0x0a, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x73, 0x74, 0x72,
-  0x3b, 0x20, 0x2f, 0x2a, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f,
-  0x66, 0x20, 0x53, 0x54, 0x52, 0x49, 0x4e, 0x47, 0x20, 0x61, 0x6e, 0x64,
-  0x20, 0x43, 0x48, 0x41, 0x52, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73,
-  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69,
-  0x64, 0x3b, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
-  0x20, 0x6f, 0x66, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x49, 0x44, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x45, 0x64, 0x67, 0x65, 0x49, 0x44, 0x20, 0x74, 0x6f,
-  0x6b, 0x65, 0x6e, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x69,
-  0x6e, 0x74, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x3b, 0x20, 0x20, 0x2f, 0x2a,
-  0x20, 0x65, 0x6e, 0x75, 0x6d, 0x20, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79,
-  0x70, 0x65, 0x73, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f,
-  0x66, 0x20, 0x4d, 0x41, 0x52, 0x4b, 0x20, 0x74, 0x6f, 0x6b, 0x65, 0x6e,
-  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x37,
-  0x31, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50, 0x61, 0x72, 0x73, 0x65,
-  0x72, 0x2e, 0x79, 0x22, 0x20, 0x2f, 0x2a, 0x20, 0x79, 0x61, 0x63, 0x63,
-  0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
-  0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c,
-  0x61, 0x62, 0x65, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72,
-  0x75, 0x63, 0x74, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x74, 0x6f, 0x6d,
-  0x20, 0x61, 0x74, 0x6f, 0x6d, 0x3b, 0x20, 0x0a, 0x0a, 0x23, 0x6c, 0x69,
-  0x6e, 0x65, 0x20, 0x38, 0x35, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50,
-  0x61, 0x72, 0x73, 0x65, 0x72, 0x2e, 0x68, 0x22, 0x20, 0x2f, 0x2a, 0x20,
-  0x79, 0x61, 0x63, 0x63, 0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20,
-  0x20, 0x2a, 0x2f, 0x0a, 0x7d, 0x3b, 0x0a, 0x23, 0x20, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x20, 0x59, 0x59, 0x53, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x49, 0x53, 0x5f, 0x54, 0x52, 0x49, 0x56, 0x49, 0x41, 0x4c, 0x20, 0x31,
-  0x0a, 0x23, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x59, 0x59,
-  0x53, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x53, 0x5f, 0x44, 0x45, 0x43,
-  0x4c, 0x41, 0x52, 0x45, 0x44, 0x20, 0x31, 0x0a, 0x23, 0x65, 0x6e, 0x64,
-  0x69, 0x66, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x4c, 0x6f, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 0x20, 0x2a,
-  0x2f, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x21, 0x20, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x65, 0x64, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x20,
-  0x26, 0x26, 0x20, 0x21, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x53, 0x5f,
-  0x44, 0x45, 0x43, 0x4c, 0x41, 0x52, 0x45, 0x44, 0x0a, 0x74, 0x79, 0x70,
-  0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
-  0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x20, 0x59, 0x59, 0x4c, 0x54,
-  0x59, 0x50, 0x45, 0x3b, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
-  0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x0a, 0x7b, 0x0a, 0x20, 0x20,
-  0x69, 0x6e, 0x74, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5f, 0x6c, 0x69,
-  0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x69,
-  0x72, 0x73, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a,
-  0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x6c,
-  0x69, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c,
-  0x61, 0x73, 0x74, 0x5f, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x3b, 0x0a,
-  0x7d, 0x3b, 0x0a, 0x23, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
-  0x59, 0x59, 0x4c, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x53, 0x5f, 0x44,
-  0x45, 0x43, 0x4c, 0x41, 0x52, 0x45, 0x44, 0x20, 0x31, 0x0a, 0x23, 0x20,
-  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x49, 0x53, 0x5f, 0x54, 0x52, 0x49, 0x56, 0x49, 0x41,
-  0x4c, 0x20, 0x31, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a,
-  0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x59, 0x59, 0x53, 0x54,
-  0x59, 0x50, 0x45, 0x20, 0x79, 0x79, 0x6c, 0x76, 0x61, 0x6c, 0x3b, 0x0a,
-  0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x59, 0x59, 0x4c, 0x54, 0x59,
-  0x50, 0x45, 0x20, 0x79, 0x79, 0x6c, 0x6c, 0x6f, 0x63, 0x3b, 0x0a, 0x69,
-  0x6e, 0x74, 0x20, 0x79, 0x79, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x28,
-  0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x22, 0x25,
-  0x63, 0x6f, 0x64, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65,
-  0x73, 0x22, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x2e, 0x20, 0x20,
-  0x2a, 0x2f, 0x0a, 0x23, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x33, 0x31, 0x20,
-  0x22, 0x68, 0x6f, 0x73, 0x74, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2e,
-  0x79, 0x22, 0x20, 0x2f, 0x2a, 0x20, 0x79, 0x61, 0x63, 0x63, 0x2e, 0x63,
-  0x3a, 0x31, 0x39, 0x30, 0x39, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x65,
-  0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
-  0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x68, 0x6f, 0x73, 0x74,
-  0x3b, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74,
-  0x20, 0x2a, 0x6e, 0x6f, 0x64, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x3b, 0x0a,
-  0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x20, 0x79, 0x79, 0x74, 0x65, 0x78, 0x74, 0x3b, 0x0a, 0x65, 0x78,
-  0x74, 0x65, 0x72, 0x6e, 0x20, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x79,
-  0x79, 0x69, 0x6e, 0x3b, 0x0a, 0x0a, 0x23, 0x6c, 0x69, 0x6e, 0x65, 0x20,
-  0x31, 0x31, 0x37, 0x20, 0x22, 0x68, 0x6f, 0x73, 0x74, 0x50, 0x61, 0x72,
-  0x73, 0x65, 0x72, 0x2e, 0x68, 0x22, 0x20, 0x2f, 0x2a, 0x20, 0x79, 0x61,
-  0x63, 0x63, 0x2e, 0x63, 0x3a, 0x31, 0x39, 0x30, 0x39, 0x20, 0x20, 0x2a,
-  0x2f, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a,
-  0x20, 0x21, 0x59, 0x59, 0x5f, 0x59, 0x59, 0x5f, 0x48, 0x4f, 0x53, 0x54,
-  0x50, 0x41, 0x52, 0x53, 0x45, 0x52, 0x5f, 0x48, 0x5f, 0x49, 0x4e, 0x43,
-  0x4c, 0x55, 0x44, 0x45, 0x44, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x47,
+  0x50, 0x20, 0x32, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x20, 0x47, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a,
+  0x20, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x78,
+  0x74, 0x75, 0x61, 0x6c, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x3a, 0x0a, 0x0a, 0x20,
+  0x20, 0x48, 0x6f, 0x73, 0x74, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x3a,
+  0x3d, 0x20, 0x27, 0x5b, 0x27, 0x20, 0x5b, 0x50, 0x6f, 0x73, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x27, 0x7c, 0x27, 0x5d, 0x20, 0x7b, 0x4e, 0x6f,
+  0x64, 0x65, 0x7d, 0x20, 0x27, 0x7c, 0x27, 0x20, 0x7b, 0x45, 0x64, 0x67,
+  0x65, 0x7d, 0x20, 0x27, 0x5d, 0x27, 0x0a, 0x20, 0x20, 0x4e, 0x6f, 0x64,
+  0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x3d, 0x20, 0x27, 0x28,
+  0x27, 0x20, 0x4e, 0x55, 0x4d, 0x20, 0x5b, 0x27, 0x28, 0x52, 0x29, 0x27,
+  0x5d, 0x20, 0x27, 0x2c, 0x27, 0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20,
+  0x5b, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x20, 0x27,
+  0x29, 0x27, 0x0a, 0x20, 0x20, 0x45, 0x64, 0x67, 0x65, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3a, 0x3d, 0x20, 0x27, 0x28, 0x27, 0x20, 0x4e, 0x55,
+  0x4d, 0x20, 0x27, 0x2c, 0x27, 0x20, 0x4e, 0x55, 0x4d, 0x20, 0x27, 0x2c,
+  0x27, 0x20, 0x4e, 0x55, 0x4d, 0x20, 0x27, 0x2c, 0x27, 0x20, 0x4c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x27, 0x29, 0x27, 0x0a, 0x20, 0x20, 0x4c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x3d, 0x20, 0x4c,
+  0x69, 0x73, 0x74, 0x20, 0x5b, 0x27, 0x23, 0x27, 0x20, 0x4d, 0x61, 0x72,
+  0x6b, 0x5d, 0x0a, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3a, 0x3d, 0x20, 0x41, 0x74, 0x6f, 0x6d, 0x20, 0x7b,
+  0x27, 0x3a, 0x27, 0x20, 0x41, 0x74, 0x6f, 0x6d, 0x7d, 0x0a, 0x20, 0x20,
+  0x41, 0x74, 0x6f, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x3d,
+  0x20, 0x4e, 0x55, 0x4d, 0x20, 0x7c, 0x20, 0x27, 0x2d, 0x27, 0x20, 0x4e,
+  0x55, 0x4d, 0x20, 0x7c, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20,
+  0x7c, 0x20, 0x27, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x27, 0x0a, 0x20, 0x20,
+  0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x20, 0x3a, 0x3d,
+  0x20, 0x27, 0x3c, 0x27, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x27, 0x2c, 0x27, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x27,
+  0x3e, 0x27, 0x0a, 0x0a, 0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x4d, 0x61, 0x72, 0x6b, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x6f, 0x66, 0x20, 0x72, 0x65, 0x64, 0x2c, 0x20, 0x67, 0x72, 0x65, 0x65,
+  0x6e, 0x2c, 0x20, 0x62, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x67, 0x72, 0x65,
+  0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x73, 0x68, 0x65, 0x64,
+  0x2c, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69,
+  0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
+  0x73, 0x2c, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x75,
+  0x6e, 0x64, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74,
+  0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x4e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6f,
+  0x73, 0x73, 0x69, 0x62, 0x6c, 0x79, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x65,
+  0x64, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6f, 0x72,
+  0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x2e, 0x20, 0x50, 0x6f,
+  0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x66,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x67, 0x6e, 0x6f,
+  0x72, 0x65, 0x64, 0x2e, 0x20, 0x57, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x6d,
+  0x65, 0x6e, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x0a, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72,
+  0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x6e, 0x79,
+  0x20, 0x74, 0x77, 0x6f, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x73,
+  0x2e, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a,
+  0x20, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x68, 0x61,
+  0x76, 0x65, 0x20, 0x6e, 0x6f, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6d,
+  0x61, 0x70, 0x70, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x6d,
+  0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2e, 0x20, 0x41, 0x20, 0x6c, 0x61, 0x72,
+  0x67, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64,
+  0x69, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x63, 0x68, 0x75, 0x6e, 0x6b, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x0a, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73,
+  0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61,
+  0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3a, 0x20,
+  0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x6f, 0x72, 0x0a, 0x20, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x61, 0x66,
+  0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x62,
+  0x72, 0x65, 0x61, 0x6b, 0x2c, 0x20, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x20,
+  0x61, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
+  0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x72,
+  0x73, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x61, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x6f, 0x72, 0x20,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20,
+  0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x0a,
+  0x20, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x28, 0x73,
+  0x65, 0x65, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2e, 0x68, 0x29, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x0a, 0x20, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x64,
+  0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a,
+  0x20, 0x20, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x50, 0x6f, 0x6c,
+  0x69, 0x63, 0x79, 0x0a, 0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x43, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x47, 0x50, 0x20, 0x32, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78,
+  0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6d, 0x69, 0x72,
+  0x72, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x0a, 0x20, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x61,
+  0x6c, 0x20, 0x65, 0x64, 0x69, 0x74, 0x6f, 0x72, 0x2e, 0x0a, 0x0a, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64,
+  0x65, 0x66, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x48, 0x4f, 0x53, 0x54, 0x5f,
+  0x50, 0x41, 0x52, 0x53, 0x45, 0x52, 0x5f, 0x48, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x48, 0x4f, 0x53,
+  0x54, 0x5f, 0x50, 0x41, 0x52, 0x53, 0x45, 0x52, 0x5f, 0x48, 0x0a, 0x0a,
+  0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65,
+  0x20, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2e, 0x68, 0x22, 0x0a, 0x0a,
+  0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x68, 0x6f, 0x73,
+  0x74, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x4d, 0x61, 0x70, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x49, 0x44, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x6e, 0x6f, 0x64,
+  0x65, 0x5f, 0x6d, 0x61, 0x70, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x20, 0x61, 0x20, 0x6c, 0x61,
+  0x72, 0x67, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x20, 0x30, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c,
+  0x0a, 0x20, 0x2a, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x6f, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65,
+  0x73, 0x73, 0x6f, 0x72, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x72, 0x73,
+  0x65, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3b, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x50, 0x61, 0x72, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69,
+  0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x65, 0x64, 0x67, 0x65, 0x0a, 0x20, 0x2a, 0x20,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x74,
+  0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x6e, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x2c, 0x20,
+  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x73, 0x73,
+  0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f, 0x73,
+  0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x65, 0x64, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x2c, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x74, 0x6f,
+  0x20, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x2c, 0x20, 0x69, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x65,
+  0x73, 0x20, 0x6e, 0x6f, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x61, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e,
+  0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+  0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65,
+  0x64, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73,
+  0x0a, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x47,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x70, 0x61, 0x72, 0x73, 0x65, 0x48,
+  0x6f, 0x73, 0x74, 0x47, 0x72, 0x61, 0x70, 0x68, 0x28, 0x46, 0x49, 0x4c,
+  0x45, 0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x48,
+  0x4f, 0x53, 0x54, 0x5f, 0x50, 0x41, 0x52, 0x53, 0x45, 0x52, 0x5f, 0x48,
+  0x20, 0x2a, 0x2f, 0x0a, 0x00
 };
-unsigned int hostParser_h_len = 3310;
+unsigned int hostParser_h_len = 2500;
 
 
 unsigned char label_h[] = {
@@ -1537,136 +2662,463 @@ unsigned char label_h[] = {
   0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x42,
   0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a, 0x2a, 0x6c, 0x69, 0x73, 0x74,
   0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
-  0x49, 0x66, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
-  0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c,
-  0x65, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x48, 0x6f, 0x73, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73,
-  0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74,
-  0x65, 0x64, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72,
-  0x61, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x28,
-  0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x29, 0x2e,
-  0x20, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x2a, 0x20, 0x70,
-  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20,
-  0x6e, 0x65, 0x77, 0x6c, 0x79, 0x2d, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61,
-  0x74, 0x65, 0x64, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74,
-  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x20, 0x2a, 0x6d, 0x61, 0x6b, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x74, 0x6f, 0x6d,
-  0x20, 0x2a, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2c, 0x20, 0x69, 0x6e, 0x74,
-  0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20, 0x62, 0x6f, 0x6f,
-  0x6c, 0x20, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x73, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x45, 0x78, 0x70, 0x65,
-  0x63, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73,
-  0x65, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74,
-  0x6f, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
-  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x49, 0x6e, 0x63, 0x72,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-  0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x0a, 0x20, 0x2a, 0x20,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x6c, 0x69, 0x73, 0x74, 0x27, 0x73, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
-  0x61, 0x64, 0x64, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x28,
-  0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x6c, 0x69,
-  0x73, 0x74, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x45, 0x78, 0x70, 0x65,
-  0x63, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73,
-  0x65, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74,
-  0x6f, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68,
-  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x44, 0x65, 0x63, 0x72,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
-  0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x0a, 0x20, 0x2a, 0x20,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x6c, 0x69, 0x73, 0x74, 0x27, 0x73, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x2e, 0x20, 0x44, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x73, 0x2f,
-  0x66, 0x72, 0x65, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69,
-  0x73, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x66, 0x0a, 0x20, 0x2a, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72,
-  0x65, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69,
-  0x73, 0x20, 0x30, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64,
-  0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74,
-  0x20, 0x2a, 0x6c, 0x69, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a,
-  0x20, 0x43, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x72,
-  0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75,
-  0x69, 0x6c, 0x64, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x2e, 0x20,
-  0x2a, 0x2f, 0x0a, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c,
-  0x20, 0x6d, 0x61, 0x6b, 0x65, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x4c, 0x61,
-  0x62, 0x65, 0x6c, 0x28, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65,
-  0x20, 0x6d, 0x61, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x48, 0x6f, 0x73, 0x74,
-  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x48, 0x6f,
-  0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x4d, 0x61, 0x72, 0x6b,
-  0x54, 0x79, 0x70, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x69,
-  0x6e, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20, 0x48,
+  0x53, 0x65, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x65,
+  0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6c, 0x65,
+  0x73, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+  0x6c, 0x79, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x70, 0x61, 0x72, 0x61,
+  0x6c, 0x6c, 0x65, 0x6c, 0x2e, 0x68, 0x29, 0x2e, 0x20, 0x54, 0x68, 0x65,
+  0x0a, 0x20, 0x2a, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x6e, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x20, 0x61, 0x20, 0x6c,
+  0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x6f,
+  0x64, 0x75, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x75, 0x74, 0x65, 0x73, 0x20, 0x6c, 0x61, 0x7a, 0x69, 0x6c, 0x79,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20,
+  0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67,
+  0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x48, 0x6f, 0x77, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x62,
+  0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x73, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x65, 0x66, 0x6f,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+  0x0a, 0x20, 0x2a, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x6d, 0x61, 0x64, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69,
+  0x6c, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x65, 0x78, 0x69,
+  0x73, 0x74, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x53, 0x48, 0x41, 0x52, 0x45,
+  0x44, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53, 0x54, 0x4f, 0x52, 0x45,
+  0x3a, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2c,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
+  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69,
+  0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x54,
+  0x68, 0x69, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69,
+  0x6d, 0x65, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x43, 0x4f, 0x4e, 0x43, 0x55,
+  0x52, 0x52, 0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53,
+  0x54, 0x4f, 0x52, 0x45, 0x3a, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x73, 0x74,
+  0x6f, 0x72, 0x65, 0x2c, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20,
+  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64,
+  0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x20, 0x73, 0x65,
+  0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x73, 0x68, 0x61, 0x72, 0x64, 0x73, 0x2c, 0x20, 0x73,
+  0x6f, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x0a, 0x20, 0x2a,
+  0x20, 0x20, 0x20, 0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x73, 0x68, 0x61, 0x72, 0x64, 0x2e, 0x0a, 0x20, 0x2a,
+  0x20, 0x50, 0x45, 0x52, 0x5f, 0x54, 0x48, 0x52, 0x45, 0x41, 0x44, 0x5f,
+  0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53, 0x54, 0x4f, 0x52, 0x45, 0x3a, 0x20,
+  0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20,
+  0x6d, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x2c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75,
+  0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x2e, 0x0a, 0x20, 0x2a, 0x20,
+  0x20, 0x20, 0x20, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x6d,
+  0x75, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x68, 0x61, 0x72,
+  0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x6f, 0x72, 0x20,
+  0x6c, 0x69, 0x73, 0x74, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+  0x72, 0x65, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x72, 0x65, 0x65, 0x48, 0x6f,
+  0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+  0x65, 0x6e, 0x75, 0x6d, 0x20, 0x7b, 0x53, 0x48, 0x41, 0x52, 0x45, 0x44,
+  0x5f, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53, 0x54, 0x4f, 0x52, 0x45, 0x20,
+  0x3d, 0x20, 0x30, 0x2c, 0x20, 0x43, 0x4f, 0x4e, 0x43, 0x55, 0x52, 0x52,
+  0x45, 0x4e, 0x54, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53, 0x54, 0x4f,
+  0x52, 0x45, 0x2c, 0x20, 0x50, 0x45, 0x52, 0x5f, 0x54, 0x48, 0x52, 0x45,
+  0x41, 0x44, 0x5f, 0x4c, 0x49, 0x53, 0x54, 0x5f, 0x53, 0x54, 0x4f, 0x52,
+  0x45, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74,
+  0x6f, 0x72, 0x65, 0x4d, 0x6f, 0x64, 0x65, 0x3b, 0x0a, 0x65, 0x78, 0x74,
+  0x65, 0x72, 0x6e, 0x20, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x6f, 0x72,
+  0x65, 0x4d, 0x6f, 0x64, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x3b, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x49, 0x66, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x68,
+  0x61, 0x73, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6e,
+  0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x48,
+  0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x6f, 0x73,
+  0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73,
+  0x65, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x62, 0x79,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20,
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x20, 0x28, 0x6c, 0x69, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x29, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x2c, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x0a, 0x20,
+  0x2a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f,
+  0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x6c, 0x79, 0x2d, 0x61, 0x6c, 0x6c,
+  0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c,
+  0x69, 0x73, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x48, 0x6f, 0x73, 0x74,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x6d, 0x61, 0x6b, 0x65, 0x48, 0x6f,
+  0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x41,
+  0x74, 0x6f, 0x6d, 0x20, 0x2a, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20,
+  0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66, 0x72, 0x65, 0x65, 0x5f, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x73, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x45,
+  0x78, 0x70, 0x65, 0x63, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+  0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x68,
+  0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x49,
+  0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x0a,
+  0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x27, 0x73, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x61, 0x64, 0x64, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69,
+  0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20,
+  0x2a, 0x6c, 0x69, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x41,
+  0x73, 0x20, 0x61, 0x64, 0x64, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73,
+  0x74, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x61, 0x64, 0x64, 0x73, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x63, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x64,
+  0x64, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x52, 0x65, 0x66,
+  0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x73, 0x28, 0x48, 0x6f, 0x73, 0x74,
+  0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x6c, 0x69, 0x73, 0x74, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x3b, 0x0a,
+  0x2f, 0x2a, 0x20, 0x45, 0x78, 0x70, 0x65, 0x63, 0x74, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x78, 0x69,
+  0x73, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69,
+  0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x2e, 0x20, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+  0x6e, 0x63, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x27, 0x73, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x20, 0x44,
+  0x65, 0x6c, 0x65, 0x74, 0x65, 0x73, 0x2f, 0x66, 0x72, 0x65, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69,
+  0x6e, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
+  0x69, 0x66, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65,
+  0x77, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x30, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x72, 0x65, 0x6d, 0x6f,
+  0x76, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x48,
   0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x6c, 0x69, 0x73,
-  0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e,
-  0x65, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20,
-  0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x65, 0x64, 0x67, 0x65,
-  0x20, 0x6e, 0x65, 0x65, 0x64, 0x73, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x62,
-  0x65, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-  0x74, 0x6f, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x0a,
-  0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20,
-  0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x69, 0x66,
-  0x20, 0x61, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f,
-  0x76, 0x69, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f,
-  0x6f, 0x6c, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x48, 0x6f, 0x73, 0x74,
-  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c,
-  0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x31, 0x2c,
-  0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c,
-  0x61, 0x62, 0x65, 0x6c, 0x32, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x55,
-  0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x75,
-  0x61, 0x74, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6d,
-  0x70, 0x61, 0x72, 0x69, 0x73, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x64,
-  0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62,
-  0x6f, 0x6f, 0x6c, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x48, 0x6f, 0x73,
-  0x74, 0x4c, 0x69, 0x73, 0x74, 0x73, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x41,
-  0x74, 0x6f, 0x6d, 0x20, 0x2a, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x6c, 0x69,
-  0x73, 0x74, 0x2c, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x74, 0x6f, 0x6d,
-  0x20, 0x2a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74,
-  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e,
-  0x74, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x67, 0x74,
-  0x68, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x5f, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x2f, 0x2a,
-  0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61,
-  0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74,
-  0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69,
-  0x73, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
-  0x63, 0x6f, 0x70, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20,
-  0x2a, 0x2f, 0x0a, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20,
-  0x2a, 0x63, 0x6f, 0x70, 0x79, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a,
-  0x6c, 0x69, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
-  0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61,
-  0x62, 0x65, 0x6c, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65,
-  0x6c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x46, 0x49, 0x4c,
-  0x45, 0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x76, 0x6f,
-  0x69, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x48, 0x6f, 0x73, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x49, 0x74, 0x65, 0x6d, 0x20, 0x2a, 0x69, 0x74, 0x65, 0x6d, 0x2c,
-  0x20, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65, 0x29,
-  0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65,
+  0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x61, 0x6c, 0x6c,
+  0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6c,
+  0x61, 0x62, 0x65, 0x6c, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x48, 0x6f,
+  0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6d, 0x61, 0x6b, 0x65,
+  0x45, 0x6d, 0x70, 0x74, 0x79, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x4d,
+  0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x20, 0x6d, 0x61, 0x72, 0x6b,
+  0x29, 0x3b, 0x0a, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c,
+  0x20, 0x6d, 0x61, 0x6b, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62,
+  0x65, 0x6c, 0x28, 0x4d, 0x61, 0x72, 0x6b, 0x54, 0x79, 0x70, 0x65, 0x20,
+  0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x65,
+  0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69,
+  0x73, 0x74, 0x20, 0x2a, 0x6c, 0x69, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64,
+  0x65, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x77, 0x68, 0x65,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x6f, 0x72, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x6e, 0x65, 0x65, 0x64,
+  0x73, 0x20, 0x72, 0x65, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x6c, 0x69, 0x6e,
+  0x67, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x76,
+  0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x65, 0x64, 0x67, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+  0x63, 0x61, 0x74, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x65, 0x71,
+  0x75, 0x61, 0x6c, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c,
+  0x73, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20,
+  0x6c, 0x61, 0x62, 0x65, 0x6c, 0x31, 0x2c, 0x20, 0x48, 0x6f, 0x73, 0x74,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x32,
+  0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x20, 0x6c,
+  0x69, 0x73, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x69, 0x73,
+  0x6f, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+  0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x65,
+  0x71, 0x75, 0x61, 0x6c, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74,
+  0x73, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x74, 0x6f, 0x6d, 0x20, 0x2a,
+  0x6c, 0x65, 0x66, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x2c, 0x20, 0x48,
+  0x6f, 0x73, 0x74, 0x41, 0x74, 0x6f, 0x6d, 0x20, 0x2a, 0x72, 0x69, 0x67,
+  0x68, 0x74, 0x5f, 0x6c, 0x69, 0x73, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x65, 0x66,
+  0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e,
+  0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x48, 0x6f,
+  0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x63, 0x6f, 0x70, 0x79,
   0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73,
   0x74, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x2a, 0x6c, 0x69, 0x73, 0x74, 0x29,
-  0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x48,
-  0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x53, 0x74, 0x6f, 0x72, 0x65,
-  0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e,
-  0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x4c,
-  0x41, 0x42, 0x45, 0x4c, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+  0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x28, 0x48,
+  0x6f, 0x73, 0x74, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x2c, 0x20, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x66, 0x69,
+  0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x28,
+  0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x49, 0x74, 0x65, 0x6d,
+  0x20, 0x2a, 0x69, 0x74, 0x65, 0x6d, 0x2c, 0x20, 0x46, 0x49, 0x4c, 0x45,
+  0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c,
+  0x69, 0x73, 0x74, 0x28, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69, 0x73, 0x74,
+  0x20, 0x2a, 0x6c, 0x69, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x48, 0x6f, 0x73, 0x74, 0x4c, 0x69,
+  0x73, 0x74, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x76, 0x6f, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20,
+  0x77, 0x61, 0x73, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x6f, 0x73, 0x65, 0x0a, 0x20, 0x2a, 0x20,
+  0x77, 0x61, 0x69, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61,
+  0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+  0x79, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x65, 0x72, 0x66, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x2e, 0x20, 0x50, 0x72, 0x69, 0x6e, 0x74, 0x73,
+  0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x77, 0x61, 0x73, 0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x6c,
+  0x6f, 0x63, 0x6b, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+  0x53, 0x74, 0x6f, 0x72, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x28, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x66, 0x69, 0x6c, 0x65,
+  0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f,
+  0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x4c, 0x41, 0x42, 0x45, 0x4c, 0x5f,
+  0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int label_h_len = 4577;
+
+unsigned char matchStore_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x0a, 0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a,
+  0x20, 0x20, 0x49, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61,
+  0x6c, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6d, 0x61, 0x69, 0x6e,
+  0x74, 0x65, 0x6e, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70,
+  0x73, 0x20, 0x28, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20,
+  0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20, 0x2d, 0x49, 0x29, 0x2e, 0x20,
+  0x41, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x27, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x70,
+  0x6c, 0x61, 0x6e, 0x3a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73,
+  0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x4c, 0x48, 0x53, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x6f, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x6f,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20,
+  0x28, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x6b, 0x65, 0x70, 0x74, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6f, 0x20,
+  0x64, 0x61, 0x74, 0x65, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+  0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6f,
+  0x72, 0x74, 0x73, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x0a, 0x20, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73,
+  0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x61, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61,
+  0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x73,
+  0x74, 0x65, 0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x2e, 0x0a, 0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a,
+  0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x49,
+  0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x53, 0x54, 0x4f,
+  0x52, 0x45, 0x5f, 0x48, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x49, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x53,
+  0x54, 0x4f, 0x52, 0x45, 0x5f, 0x48, 0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63,
+  0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x73, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+  0x65, 0x20, 0x22, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x68, 0x22, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x69,
+  0x6d, 0x75, 0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x72, 0x72, 0x61,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x61,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x6e, 0x65,
+  0x65, 0x64, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x20,
+  0x62, 0x65, 0x79, 0x6f, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x66,
+  0x61, 0x6c, 0x6c, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f,
+  0x0a, 0x20, 0x2a, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6e,
+  0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20,
+  0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75,
+  0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x53,
+  0x54, 0x4f, 0x52, 0x45, 0x5f, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x20, 0x31,
+  0x30, 0x34, 0x38, 0x35, 0x37, 0x36, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54,
+  0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x70, 0x6c, 0x61, 0x6e, 0x20, 0x6f, 0x70,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79,
+  0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x28,
+  0x2a, 0x4e, 0x6f, 0x64, 0x65, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x29,
+  0x28, 0x4e, 0x6f, 0x64, 0x65, 0x20, 0x2a, 0x6e, 0x6f, 0x64, 0x65, 0x29,
+  0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20,
+  0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x69,
+  0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+  0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+  0x6f, 0x72, 0x65, 0x27, 0x73, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69,
+  0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x2d, 0x20, 0x49,
+  0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x2e, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69,
+  0x6e, 0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x73, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2c, 0x20, 0x6f, 0x72,
+  0x20, 0x2d, 0x31, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2e,
+  0x20, 0x55, 0x73, 0x65, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x20,
+  0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72,
+  0x65, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+  0x74, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x76,
+  0x61, 0x6c, 0x69, 0x64, 0x20, 0x2d, 0x20, 0x53, 0x65, 0x74, 0x20, 0x74,
+  0x6f, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x61, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20,
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68,
+  0x53, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x47,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x46, 0x69, 0x6c, 0x74,
+  0x65, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x2c, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x69, 0x74, 0x65,
+  0x6d, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x70,
+  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x4d, 0x61, 0x74, 0x63,
+  0x68, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x2a, 0x6e, 0x65, 0x78, 0x74,
+  0x3b, 0x0a, 0x7d, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x72, 0x65, 0x61,
+  0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c,
+  0x61, 0x74, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x0a, 0x20, 0x2a, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x73, 0x6f, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x0a, 0x20,
+  0x2a, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x53, 0x74,
+  0x6f, 0x72, 0x65, 0x20, 0x2a, 0x6d, 0x61, 0x6b, 0x65, 0x4d, 0x61, 0x74,
+  0x63, 0x68, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x47, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x4e, 0x6f,
+  0x64, 0x65, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6c,
+  0x74, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x61,
+  0x6c, 0x6c, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+  0x20, 0x28, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x5f, 0x68, 0x6f,
+  0x6f, 0x6b, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x76,
+  0x65, 0x72, 0x79, 0x0a, 0x20, 0x2a, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x64, 0x64, 0x65,
+  0x64, 0x2c, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x2c, 0x20,
+  0x72, 0x65, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x6c, 0x65, 0x64, 0x2c, 0x20,
+  0x72, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x2c, 0x20, 0x28, 0x75,
+  0x6e, 0x29, 0x72, 0x6f, 0x6f, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20,
+  0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x0a, 0x20, 0x2a, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x2e,
+  0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x72, 0x65, 0x74, 0x65, 0x73,
+  0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20,
+  0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76,
+  0x6f, 0x69, 0x64, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x4d, 0x61,
+  0x74, 0x63, 0x68, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x28, 0x47, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x4d, 0x61, 0x74,
+  0x63, 0x68, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x28, 0x76, 0x6f, 0x69,
+  0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20,
+  0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x54, 0x43, 0x48,
+  0x5f, 0x53, 0x54, 0x4f, 0x52, 0x45, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a,
+  0x00
 };
-unsigned int label_h_len = 3142;
+unsigned int matchStore_h_len = 2424;
 
 unsigned char morphism_h[] = {
   0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
@@ -1951,121 +3403,145 @@ unsigned char morphism_h[] = {
   0x70, 0x45, 0x64, 0x67, 0x65, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69,
   0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d,
   0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54,
-  0x68, 0x65, 0x73, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f,
-  0x20, 0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x69, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x76,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61,
-  0x74, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
-  0x69, 0x6e, 0x74, 0x20, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x67,
-  0x65, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x4d, 0x6f, 0x72, 0x70,
-  0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69,
-  0x73, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x29, 0x3b,
-  0x0a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x65, 0x74, 0x53,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x4d,
-  0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72,
-  0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69,
-  0x64, 0x29, 0x3b, 0x0a, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65,
-  0x6e, 0x74, 0x20, 0x67, 0x65, 0x74, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e,
-  0x6d, 0x65, 0x6e, 0x74, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73,
-  0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c,
-  0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x2f, 0x2a,
-  0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x75, 0x6c,
-  0x65, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x20, 0x74, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6d, 0x61, 0x74,
-  0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x6c, 0x69,
-  0x73, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e,
-  0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x65, 0x74, 0x41,
-  0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x65, 0x6e,
-  0x67, 0x74, 0x68, 0x28, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65,
-  0x6e, 0x74, 0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e,
-  0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64,
-  0x20, 0x74, 0x6f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
-  0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c,
-  0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x20,
-  0x68, 0x6f, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e,
-  0x20, 0x49, 0x66, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x72, 0x75, 0x6c, 0x65,
-  0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61,
-  0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69,
-  0x6e, 0x67, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x63,
-  0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x6c, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
-  0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20,
-  0x69, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x2c,
-  0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6b, 0x6e, 0x6f, 0x77,
-  0x73, 0x0a, 0x20, 0x2a, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69,
-  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73,
-  0x75, 0x6d, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67,
-  0x2e, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78,
-  0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x73, 0x50, 0x72, 0x65,
-  0x66, 0x69, 0x78, 0x28, 0x22, 0x61, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x61,
+  0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x69, 0x74,
+  0x65, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6d,
+  0x61, 0x67, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20,
+  0x4c, 0x48, 0x53, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x2e, 0x20, 0x55, 0x73,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6f,
+  0x66, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x20, 0x62, 0x79, 0x20, 0x72, 0x75, 0x6c, 0x65,
+  0x73, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e,
+  0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x65, 0x65,
+  0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x2e, 0x68, 0x29,
+  0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x49, 0x6e, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x4d, 0x6f,
+  0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70,
+  0x68, 0x69, 0x73, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x62,
+  0x6f, 0x6f, 0x6c, 0x20, 0x65, 0x64, 0x67, 0x65, 0x49, 0x6e, 0x49, 0x6d,
+  0x61, 0x67, 0x65, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d,
+  0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65,
+  0x73, 0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x62,
+  0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x69, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x61, 0x70, 0x70, 0x72, 0x6f, 0x70, 0x72, 0x69, 0x61, 0x74, 0x65,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e,
+  0x74, 0x20, 0x67, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+  0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69,
+  0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d,
+  0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x65, 0x74, 0x53, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x4d, 0x6f, 0x72,
+  0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68,
+  0x69, 0x73, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x29,
+  0x3b, 0x0a, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x67, 0x65, 0x74, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65,
+  0x6e, 0x74, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20,
+  0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x55,
+  0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20,
+  0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x74, 0x6f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x20, 0x2a,
+  0x2f, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x65, 0x74, 0x41, 0x73, 0x73,
+  0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x65, 0x6e, 0x67, 0x74,
+  0x68, 0x28, 0x41, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+  0x20, 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x29,
+  0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x74,
+  0x6f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20,
+  0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x61, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x49,
+  0x66, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73,
+  0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70,
+  0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+  0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x68, 0x6f, 0x73, 0x74, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x63, 0x68, 0x61,
+  0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
+  0x74, 0x6c, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x69, 0x73,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x2c, 0x20, 0x73,
+  0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6b, 0x6e, 0x6f, 0x77, 0x73, 0x0a,
+  0x20, 0x2a, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6d,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x2e, 0x20,
+  0x0a, 0x20, 0x2a, 0x20, 0x46, 0x6f, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x2c, 0x20, 0x69, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x28, 0x22, 0x61, 0x62, 0x22, 0x2c, 0x20, 0x22, 0x61, 0x62, 0x63,
+  0x64, 0x22, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20,
+  0x32, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+  0x74, 0x65, 0x72, 0x20, 0x28, 0x27, 0x63, 0x27, 0x29, 0x20, 0x61, 0x66,
+  0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x64, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x28, 0x22, 0x61, 0x62, 0x22, 0x29, 0x2e, 0x0a, 0x20, 0x2a,
+  0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x2d, 0x31, 0x20,
+  0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75,
+  0x6c, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x73,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73,
+  0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x2a, 0x2f,
+  0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69,
+  0x78, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x41,
+  0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x6f, 0x75, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x69, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2e, 0x20, 0x45, 0x78,
+  0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x69, 0x73, 0x53, 0x75, 0x66,
+  0x66, 0x69, 0x78, 0x28, 0x22, 0x63, 0x64, 0x22, 0x2c, 0x20, 0x22, 0x61,
   0x62, 0x63, 0x64, 0x22, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x73, 0x20, 0x32, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
-  0x72, 0x73, 0x74, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x63, 0x68, 0x61, 0x72,
-  0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x28, 0x27, 0x63, 0x27, 0x29, 0x20,
-  0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61,
-  0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x20, 0x28, 0x22, 0x61, 0x62, 0x22, 0x29, 0x2e, 0x0a,
-  0x20, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x2d,
-  0x31, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x72, 0x75, 0x6c, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20,
-  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65,
-  0x66, 0x69, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68,
-  0x6f, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x20,
-  0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x50, 0x72, 0x65,
-  0x66, 0x69, 0x78, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
-  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f,
-  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a,
-  0x20, 0x41, 0x6e, 0x61, 0x6c, 0x6f, 0x67, 0x6f, 0x75, 0x73, 0x20, 0x74,
-  0x6f, 0x20, 0x69, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2e, 0x20,
-  0x45, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x3a, 0x20, 0x69, 0x73, 0x53,
-  0x75, 0x66, 0x66, 0x69, 0x78, 0x28, 0x22, 0x63, 0x64, 0x22, 0x2c, 0x20,
-  0x22, 0x61, 0x62, 0x63, 0x64, 0x22, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6e, 0x73, 0x20, 0x31, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x66, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72,
-  0x20, 0x28, 0x27, 0x62, 0x27, 0x29, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x6c, 0x79, 0x20, 0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e,
-  0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65,
-  0x64, 0x20, 0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x20, 0x28, 0x22, 0x63,
-  0x64, 0x22, 0x29, 0x2e, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65,
-  0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69,
-  0x73, 0x20, 0x69, 0x66, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x73, 0x20,
-  0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c,
-  0x20, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61,
-  0x73, 0x65, 0x20, 0x30, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
-  0x69, 0x6e, 0x74, 0x20, 0x69, 0x73, 0x53, 0x75, 0x66, 0x66, 0x69, 0x78,
-  0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
-  0x70, 0x72, 0x69, 0x6e, 0x74, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73,
-  0x6d, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a,
-  0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x29, 0x3b, 0x0a, 0x76,
-  0x6f, 0x69, 0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x4d, 0x6f, 0x72, 0x70,
-  0x68, 0x69, 0x73, 0x6d, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73,
-  0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x29,
-  0x3b, 0x0a, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f,
-  0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f,
-  0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+  0x73, 0x20, 0x31, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x28,
+  0x27, 0x62, 0x27, 0x29, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c,
+  0x79, 0x20, 0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20,
+  0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x20, 0x28, 0x22, 0x63, 0x64, 0x22,
+  0x29, 0x2e, 0x20, 0x0a, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x65,
+  0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20,
+  0x69, 0x66, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x73, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x69,
+  0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65,
+  0x20, 0x30, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x73, 0x53, 0x75, 0x66, 0x66, 0x69, 0x78, 0x28, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2c,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x72,
+  0x69, 0x6e, 0x74, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x28,
+  0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f,
+  0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x66, 0x72, 0x65, 0x65, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69,
+  0x73, 0x6d, 0x28, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20,
+  0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x29, 0x3b, 0x0a,
+  0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20,
+  0x49, 0x4e, 0x43, 0x5f, 0x4d, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x48, 0x20,
+  0x2a, 0x2f, 0x0a, 0x00
 };
-unsigned int morphism_h_len = 4734;
+unsigned int morphism_h_len = 5019;
 
 unsigned char tracing_h[] = {
   0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
@@ -2468,3 +3944,793 @@ unsigned char tracing_h[] = {
   0x43, 0x49, 0x4e, 0x47, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a
 };
 unsigned int tracing_h_len = 4774;
+
+unsigned char parallel_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20,
+  0x20, 0x50, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x4d, 0x61,
+  0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x0a, 0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x20, 0x20, 0x53, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x65, 0x73, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x68,
+  0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6f,
+  0x66, 0x20, 0x61, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x6f, 0x6e, 0x20,
+  0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74, 0x68, 0x72, 0x65,
+  0x61, 0x64, 0x73, 0x0a, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6d, 0x70, 0x69,
+  0x6c, 0x65, 0x72, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x2d, 0x54, 0x29,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x76, 0x69,
+  0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x62, 0x6c, 0x6f,
+  0x63, 0x6b, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x74,
+  0x68, 0x65, 0x0a, 0x20, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73,
+  0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x75,
+  0x72, 0x6e, 0x2e, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x61, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+  0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x27, 0x73, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x70, 0x6c, 0x61, 0x6e, 0x2c, 0x20, 0x75, 0x73, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72,
+  0x61, 0x74, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d,
+  0x70, 0x6c, 0x65, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x20,
+  0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x6f, 0x77, 0x6e, 0x0a, 0x20, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68,
+  0x69, 0x73, 0x6d, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x6f,
+  0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x61, 0x6c,
+  0x73, 0x6f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x20,
+  0x62, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6c,
+  0x6f, 0x6f, 0x70, 0x73, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x62,
+  0x6f, 0x64, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x73,
+  0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x20, 0x28, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+  0x72, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x2d, 0x62, 0x29, 0x2e, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20,
+  0x6f, 0x66, 0x20, 0x61, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x64,
+  0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61,
+  0x70, 0x2c, 0x0a, 0x20, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x20,
+  0x69, 0x6e, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x4c, 0x48, 0x53, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x74,
+  0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65,
+  0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x73, 0x20, 0x75, 0x6e, 0x63, 0x68,
+  0x61, 0x6e, 0x67, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65,
+  0x20, 0x69, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x75, 0x73, 0x65, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x69, 0x73,
+  0x53, 0x68, 0x61, 0x72, 0x61, 0x62, 0x6c, 0x65, 0x4e, 0x6f, 0x64, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x2e, 0x68, 0x29, 0x2e,
+  0x20, 0x41, 0x70, 0x70, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x68,
+  0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
+  0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x61, 0x73, 0x20, 0x73, 0x6f,
+  0x6d, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6c, 0x0a, 0x20, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x6f,
+  0x70, 0x2e, 0x20, 0x42, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x0a, 0x20, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x74,
+  0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x75, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6c, 0x65, 0x73, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x20, 0x69,
+  0x73, 0x0a, 0x20, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68,
+  0x69, 0x73, 0x6d, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20,
+  0x6f, 0x66, 0x20, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61,
+  0x67, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f,
+  0x73, 0x74, 0x0a, 0x20, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20,
+  0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x68,
+  0x61, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+  0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+  0x27, 0x73, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2d,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a, 0x2f,
+  0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x49, 0x4e,
+  0x43, 0x5f, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c, 0x5f, 0x48,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x4e, 0x43,
+  0x5f, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c, 0x5f, 0x48, 0x0a,
+  0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+  0x65, 0x20, 0x22, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2e,
+  0x68, 0x22, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79,
+  0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x53, 0x65, 0x74, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72,
+  0x61, 0x74, 0x65, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x0a, 0x20, 0x2a,
+  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x41,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x31, 0x20,
+  0x6f, 0x72, 0x20, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65,
+  0x6c, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x5f, 0x74, 0x68, 0x72,
+  0x65, 0x61, 0x64, 0x73, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x48, 0x6f,
+  0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x3a, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x0a,
+  0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+  0x64, 0x73, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x63, 0x6f, 0x73,
+  0x74, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2e, 0x20,
+  0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x50,
+  0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c, 0x5f, 0x54, 0x48, 0x52, 0x45,
+  0x53, 0x48, 0x4f, 0x4c, 0x44, 0x20, 0x36, 0x35, 0x35, 0x33, 0x36, 0x0a,
+  0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+  0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20,
+  0x74, 0x69, 0x6d, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45,
+  0x4c, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x20, 0x31, 0x30, 0x32, 0x34,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74,
+  0x65, 0x73, 0x20, 0x61, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x69, 0x73, 0x20, 0x74, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x61,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20,
+  0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x70, 0x6c,
+  0x61, 0x6e, 0x2e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20,
+  0x74, 0x72, 0x75, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c,
+  0x0a, 0x20, 0x2a, 0x20, 0x6f, 0x72, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f,
+  0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x75, 0x6e, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74, 0x79, 0x70,
+  0x65, 0x64, 0x65, 0x66, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x28, 0x2a,
+  0x4e, 0x6f, 0x64, 0x65, 0x54, 0x65, 0x73, 0x74, 0x65, 0x72, 0x29, 0x28,
+  0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f,
+  0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2c, 0x20, 0x4e, 0x6f, 0x64, 0x65,
+  0x20, 0x2a, 0x6e, 0x6f, 0x64, 0x65, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a,
+  0x20, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x65, 0x72, 0x20,
+  0x6f, 0x6e, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x5f, 0x74, 0x68,
+  0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+  0x73, 0x2c, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x61, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69,
+  0x73, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x61, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x6d, 0x6f,
+  0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x73,
+  0x6f, 0x6d, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+  0x69, 0x6e, 0x64, 0x73, 0x20, 0x61, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x2c, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6d, 0x6f, 0x72,
+  0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x73, 0x77, 0x61,
+  0x70, 0x70, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x72,
+  0x70, 0x68, 0x69, 0x73, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x72,
+  0x75, 0x65, 0x20, 0x69, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x65, 0x64, 0x2e, 0x20, 0x57, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6f,
+  0x75, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x64, 0x73, 0x20,
+  0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x68, 0x65, 0x64,
+  0x75, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2e, 0x0a, 0x20, 0x2a,
+  0x20, 0x63, 0x6f, 0x6e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x28, 0x73, 0x65,
+  0x65, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2e, 0x68, 0x29, 0x20, 0x69,
+  0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20,
+  0x72, 0x75, 0x6e, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x49, 0x6e, 0x50, 0x61, 0x72, 0x61,
+  0x6c, 0x6c, 0x65, 0x6c, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x4d, 0x6f, 0x72, 0x70, 0x68,
+  0x69, 0x73, 0x6d, 0x20, 0x2a, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73,
+  0x6d, 0x2c, 0x20, 0x4e, 0x6f, 0x64, 0x65, 0x54, 0x65, 0x73, 0x74, 0x65,
+  0x72, 0x20, 0x74, 0x65, 0x73, 0x74, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x5b, 0x30,
+  0x5d, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73,
+  0x5b, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61,
+  0x74, 0x63, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x72,
+  0x70, 0x68, 0x69, 0x73, 0x6d, 0x73, 0x0a, 0x20, 0x2a, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x5b, 0x73,
+  0x69, 0x7a, 0x65, 0x5d, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x73, 0x5b, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+  0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e,
+  0x75, 0x73, 0x65, 0x64, 0x2e, 0x20, 0x42, 0x69, 0x74, 0x20, 0x69, 0x20,
+  0x6f, 0x66, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x68, 0x61, 0x72, 0x61, 0x62,
+  0x6c, 0x65, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20, 0x4c, 0x48, 0x53, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x20, 0x69, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x20, 0x61, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x6c, 0x73, 0x6f, 0x0a, 0x20, 0x2a, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x2e, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x5f, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x65, 0x64, 0x67, 0x65, 0x5f, 0x63, 0x6c, 0x61, 0x69,
+  0x6d, 0x73, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2c, 0x0a, 0x20,
+  0x2a, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x68,
+  0x6f, 0x73, 0x74, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x2c, 0x20, 0x77, 0x68,
+  0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+  0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x65,
+  0x65, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x2e, 0x63,
+  0x29, 0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x61,
+  0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6b, 0x65,
+  0x70, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x73, 0x74,
+  0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+  0x79, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20, 0x66, 0x72, 0x65,
+  0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x2a, 0x20,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
+  0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x42, 0x61, 0x74, 0x63,
+  0x68, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x2c, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74,
+  0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x4d, 0x6f, 0x72, 0x70, 0x68, 0x69,
+  0x73, 0x6d, 0x20, 0x2a, 0x2a, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64,
+  0x65, 0x73, 0x2c, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x76,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x61, 0x72,
+  0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x5f,
+  0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x5f, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+  0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6e, 0x6f, 0x64, 0x65, 0x5f,
+  0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x2c, 0x20, 0x2a, 0x65, 0x64, 0x67,
+  0x65, 0x5f, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x73, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x4d, 0x61, 0x74, 0x63,
+  0x68, 0x42, 0x61, 0x74, 0x63, 0x68, 0x20, 0x2a, 0x6e, 0x65, 0x78, 0x74,
+  0x3b, 0x0a, 0x7d, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x42, 0x61, 0x74,
+  0x63, 0x68, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20,
+  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x6d, 0x65, 0x6e, 0x73,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x72, 0x75, 0x6c, 0x65, 0x27, 0x73, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68,
+  0x69, 0x73, 0x6d, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x4d, 0x61, 0x74,
+  0x63, 0x68, 0x42, 0x61, 0x74, 0x63, 0x68, 0x20, 0x2a, 0x6d, 0x61, 0x6b,
+  0x65, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x42, 0x61, 0x74, 0x63, 0x68, 0x28,
+  0x69, 0x6e, 0x74, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x65, 0x64, 0x67, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73,
+  0x68, 0x61, 0x72, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x6e, 0x6f, 0x64, 0x65,
+  0x73, 0x29, 0x3b, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x65, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+  0x61, 0x74, 0x63, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+  0x62, 0x61, 0x74, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64,
+  0x0a, 0x20, 0x2a, 0x20, 0x62, 0x79, 0x20, 0x74, 0x65, 0x73, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6e, 0x6f, 0x64, 0x65,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x65, 0x72, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x61,
+  0x74, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x72, 0x75, 0x6c, 0x65, 0x0a, 0x20, 0x2a, 0x20, 0x68, 0x61, 0x73,
+  0x20, 0x6e, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2e, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x61, 0x70,
+  0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x65, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x6d, 0x6f, 0x72, 0x70, 0x68, 0x69, 0x73, 0x6d, 0x73, 0x2e,
+  0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x65, 0x63, 0x74, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x28,
+  0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x2c, 0x20, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x2a, 0x62, 0x61, 0x74, 0x63, 0x68, 0x2c, 0x20, 0x4e, 0x6f, 0x64,
+  0x65, 0x54, 0x65, 0x73, 0x74, 0x65, 0x72, 0x20, 0x74, 0x65, 0x73, 0x74,
+  0x65, 0x72, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x66, 0x72,
+  0x65, 0x65, 0x4d, 0x61, 0x74, 0x63, 0x68, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x65, 0x73, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x23,
+  0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43,
+  0x5f, 0x50, 0x41, 0x52, 0x41, 0x4c, 0x4c, 0x45, 0x4c, 0x5f, 0x48, 0x20,
+  0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int parallel_h_len = 3951;
+
+unsigned char components_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e,
+  0x65, 0x6e, 0x74, 0x73, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x0a,
+  0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x20, 0x20, 0x52,
+  0x75, 0x6e, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+  0x74, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x70, 0x72, 0x6f, 0x67,
+  0x72, 0x61, 0x6d, 0x73, 0x20, 0x28, 0x73, 0x65, 0x65, 0x20, 0x69, 0x73,
+  0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f,
+  0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x27, 0x73, 0x0a, 0x20, 0x20, 0x61,
+  0x6e, 0x61, 0x6c, 0x79, 0x73, 0x69, 0x73, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+  0x6c, 0x65, 0x29, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+  0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6f,
+  0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x6c, 0x79,
+  0x0a, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72,
+  0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x2d, 0x43, 0x29, 0x2e, 0x20, 0x53,
+  0x75, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x73,
+  0x20, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x61, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74,
+  0x68, 0x65, 0x0a, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x69, 0x73,
+  0x20, 0x61, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d,
+  0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x77, 0x68,
+  0x6f, 0x6c, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x2e, 0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72,
+  0x65, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x61, 0x6d,
+  0x6f, 0x6e, 0x67, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x28, 0x73, 0x65,
+  0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x2e, 0x68, 0x29,
+  0x2e, 0x20, 0x45, 0x61, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x6b, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x69,
+  0x74, 0x73, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+  0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x61, 0x74, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x2c, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x6f, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x0a, 0x20,
+  0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72,
+  0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65,
+  0x72, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e,
+  0x20, 0x4e, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x6e, 0x6f, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x20,
+  0x68, 0x6f, 0x6c, 0x64, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20,
+  0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73,
+  0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+  0x74, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2e,
+  0x0a, 0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69,
+  0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x43, 0x4f,
+  0x4d, 0x50, 0x4f, 0x4e, 0x45, 0x4e, 0x54, 0x53, 0x5f, 0x48, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x43,
+  0x4f, 0x4d, 0x50, 0x4f, 0x4e, 0x45, 0x4e, 0x54, 0x53, 0x5f, 0x48, 0x0a,
+  0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x69,
+  0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x72, 0x61, 0x70,
+  0x68, 0x2e, 0x68, 0x22, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x75, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61,
+  0x6d, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x73,
+  0x73, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+  0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x0a, 0x20,
+  0x2a, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x66,
+  0x72, 0x65, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x74,
+  0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68,
+  0x20, 0x2a, 0x28, 0x2a, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+  0x74, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x29, 0x28, 0x47, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x2a, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65,
+  0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x75, 0x6e,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61,
+  0x6d, 0x20, 0x6f, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6f,
+  0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x0a, 0x20, 0x2a,
+  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+  0x73, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x6e, 0x69, 0x6f,
+  0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73,
+  0x75, 0x6c, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x0a,
+  0x20, 0x2a, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69,
+  0x6c, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f,
+  0x72, 0x6d, 0x61, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x47, 0x72, 0x61, 0x70, 0x68, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x64,
+  0x67, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x61, 0x72, 0x65,
+  0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x20, 0x62, 0x79, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+  0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68,
+  0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x72, 0x75, 0x6e, 0x4f, 0x6e, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e,
+  0x65, 0x6e, 0x74, 0x73, 0x28, 0x47, 0x72, 0x61, 0x70, 0x68, 0x20, 0x2a,
+  0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x6f,
+  0x6e, 0x65, 0x6e, 0x74, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x2c, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x46, 0x49,
+  0x4c, 0x45, 0x20, 0x2a, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 0x3b,
+  0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20,
+  0x49, 0x4e, 0x43, 0x5f, 0x43, 0x4f, 0x4d, 0x50, 0x4f, 0x4e, 0x45, 0x4e,
+  0x54, 0x53, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int components_h_len = 1640;
+
+unsigned char batch_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20,
+  0x20, 0x42, 0x61, 0x74, 0x63, 0x68, 0x20, 0x4d, 0x6f, 0x64, 0x75, 0x6c,
+  0x65, 0x0a, 0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x0a, 0x20, 0x20, 0x52, 0x75, 0x6e, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+  0x64, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x6f, 0x6e,
+  0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x72, 0x75, 0x6e, 0x74,
+  0x69, 0x6d, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69,
+  0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73,
+  0x0a, 0x0a, 0x20, 0x20, 0x67, 0x70, 0x32, 0x72, 0x75, 0x6e, 0x20, 0x5b,
+  0x2d, 0x77, 0x20, 0x3c, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x3e,
+  0x5d, 0x20, 0x3c, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x3e, 0x0a, 0x0a,
+  0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+  0x6f, 0x72, 0x79, 0x2c, 0x20, 0x77, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x72,
+  0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73,
+  0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x69, 0x72, 0x0a, 0x20, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2c,
+  0x20, 0x61, 0x20, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x20,
+  0x66, 0x69, 0x6c, 0x65, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67,
+  0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x70, 0x65,
+  0x72, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x6f, 0x72,
+  0x20, 0x2d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+  0x65, 0x61, 0x6d, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6e, 0x63, 0x61,
+  0x74, 0x65, 0x6e, 0x61, 0x74, 0x65, 0x64, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x73,
+  0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x0a,
+  0x20, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x77, 0x68, 0x6f, 0x73,
+  0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6f,
+  0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64, 0x2e,
+  0x0a, 0x0a, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x61, 0x6d, 0x6f, 0x6e,
+  0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x65, 0x73, 0x20, 0x28, 0x31, 0x0a, 0x20, 0x20, 0x62, 0x79, 0x20, 0x64,
+  0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x2e, 0x68, 0x29, 0x2e, 0x20,
+  0x45, 0x61, 0x63, 0x68, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x20,
+  0x70, 0x61, 0x72, 0x73, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x68,
+  0x6f, 0x73, 0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x73, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6d, 0x65,
+  0x2c, 0x0a, 0x20, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70,
+  0x65, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x74, 0x65,
+  0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x66, 0x69, 0x6c, 0x65,
+  0x2e, 0x20, 0x54, 0x68, 0x65, 0x0a, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e,
+  0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x67,
+  0x70, 0x32, 0x2e, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x73, 0x75, 0x6d, 0x6d,
+  0x61, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x20,
+  0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x65, 0x64, 0x2e, 0x0a,
+  0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x66,
+  0x6e, 0x64, 0x65, 0x66, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x42, 0x41, 0x54,
+  0x43, 0x48, 0x5f, 0x48, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x49, 0x4e, 0x43, 0x5f, 0x42, 0x41, 0x54, 0x43, 0x48, 0x5f, 0x48,
+  0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x23,
+  0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x2e, 0x68, 0x22, 0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x52, 0x75,
+  0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72,
+  0x61, 0x6d, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x67, 0x72,
+  0x61, 0x70, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6e,
+  0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x2c, 0x20, 0x6f, 0x72, 0x0a,
+  0x20, 0x2a, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6f,
+  0x6e, 0x20, 0x77, 0x68, 0x79, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x69, 0x73, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x2c, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66,
+  0x69, 0x6c, 0x65, 0x2e, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73,
+  0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x0a, 0x20, 0x2a, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d,
+  0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a,
+  0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x62, 0x6f, 0x6f, 0x6c,
+  0x20, 0x28, 0x2a, 0x42, 0x61, 0x74, 0x63, 0x68, 0x50, 0x72, 0x6f, 0x67,
+  0x72, 0x61, 0x6d, 0x29, 0x28, 0x46, 0x49, 0x4c, 0x45, 0x20, 0x2a, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x29, 0x3b, 0x0a, 0x0a, 0x2f, 0x2a, 0x20,
+  0x43, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e,
+  0x74, 0x69, 0x6d, 0x65, 0x27, 0x73, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20, 0x52, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78,
+  0x69, 0x74, 0x0a, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x74,
+  0x69, 0x6d, 0x65, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x74, 0x20,
+  0x72, 0x75, 0x6e, 0x42, 0x61, 0x74, 0x63, 0x68, 0x28, 0x69, 0x6e, 0x74,
+  0x20, 0x61, 0x72, 0x67, 0x63, 0x2c, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+  0x2a, 0x2a, 0x61, 0x72, 0x67, 0x76, 0x2c, 0x20, 0x42, 0x61, 0x74, 0x63,
+  0x68, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x70, 0x72, 0x6f,
+  0x67, 0x72, 0x61, 0x6d, 0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x20, 0x2f, 0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x42, 0x41,
+  0x54, 0x43, 0x48, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int batch_h_len = 1461;
+
+unsigned char speculation_h[] = {
+  0x2f, 0x2a, 0x20, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0a, 0x0a, 0x20, 0x20, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x53, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x4d, 0x6f, 0x64, 0x75,
+  0x6c, 0x65, 0x0a, 0x20, 0x20, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x0a, 0x0a, 0x20, 0x20, 0x52, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68,
+  0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x74, 0x72, 0x79, 0x20, 0x73, 0x74,
+  0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x20, 0x77, 0x68,
+  0x69, 0x6c, 0x65, 0x20, 0x69, 0x74, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x69, 0x73, 0x20, 0x65,
+  0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x64, 0x20, 0x28, 0x63, 0x6f,
+  0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20,
+  0x2d, 0x53, 0x29, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e,
+  0x74, 0x69, 0x6d, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x77,
+  0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x79, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20,
+  0x62, 0x65, 0x67, 0x69, 0x6e, 0x73, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x20, 0x67, 0x69, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6e, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x2d, 0x6f, 0x6e, 0x2d, 0x77, 0x72,
+  0x69, 0x74, 0x65, 0x20, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x0a, 0x20, 0x20, 0x67, 0x72, 0x61, 0x70, 0x68, 0x20, 0x28, 0x66, 0x6f,
+  0x72, 0x20, 0x77, 0x68, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73,
+  0x73, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
+  0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72,
+  0x73, 0x2e, 0x68, 0x29, 0x2e, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x61,
+  0x72, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x20, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x65, 0x73, 0x0a, 0x20,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63,
+  0x65, 0x73, 0x73, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x73, 0x20, 0x69, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x63,
+  0x68, 0x0a, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x72, 0x65, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x6f, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x2e,
+  0x0a, 0x0a, 0x20, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x75, 0x63,
+  0x63, 0x65, 0x65, 0x64, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+  0x61, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6e, 0x20, 0x62, 0x72, 0x61, 0x6e,
+  0x63, 0x68, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x73, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6e, 0x61,
+  0x70, 0x73, 0x68, 0x6f, 0x74, 0x20, 0x69, 0x73, 0x20, 0x65, 0x78, 0x61,
+  0x63, 0x74, 0x6c, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61,
+  0x70, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x63,
+  0x68, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x72,
+  0x75, 0x6e, 0x20, 0x6f, 0x6e, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x27, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x2c, 0x0a,
+  0x20, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+  0x65, 0x6e, 0x74, 0x20, 0x6c, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65,
+  0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x74, 0x73,
+  0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x77, 0x61, 0x69, 0x74,
+  0x73, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+  0x2e, 0x20, 0x41, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x77, 0x61, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x0a, 0x20, 0x20, 0x64, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f,
+  0x6e, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x79,
+  0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x3a, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x53, 0x70, 0x65,
+  0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20,
+  0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x66,
+  0x6f, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x65,
+  0x64, 0x2e, 0x20, 0x41, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61,
+  0x74, 0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73,
+  0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+  0x2c, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x0a, 0x20,
+  0x20, 0x69, 0x74, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x73, 0x20, 0x6f,
+  0x72, 0x20, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65,
+  0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x2c, 0x20, 0x77, 0x68, 0x65,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75,
+  0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x0a,
+  0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74,
+  0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x61, 0x62,
+  0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x2c, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6f, 0x6e,
+  0x63, 0x65, 0x20, 0x69, 0x66, 0x20, 0x73, 0x6f, 0x2e, 0x0a, 0x0a, 0x20,
+  0x20, 0x41, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73,
+  0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75,
+  0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x6c, 0x79, 0x20, 0x6d, 0x61, 0x79,
+  0x20, 0x69, 0x74, 0x73, 0x65, 0x6c, 0x66, 0x20, 0x73, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+  0x0a, 0x20, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x6e, 0x65, 0x76, 0x65,
+  0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x20, 0x73,
+  0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77,
+  0x68, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6e,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x73,
+  0x0a, 0x20, 0x20, 0x62, 0x65, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76, 0x61,
+  0x6c, 0x75, 0x61, 0x74, 0x65, 0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x65,
+  0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x68, 0x61, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x0a, 0x20, 0x20,
+  0x77, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x61, 0x20, 0x64, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x2e, 0x0a,
+  0x0a, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f,
+  0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0x2a, 0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x66,
+  0x6e, 0x64, 0x65, 0x66, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x53, 0x50, 0x45,
+  0x43, 0x55, 0x4c, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x48, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x53,
+  0x50, 0x45, 0x43, 0x55, 0x4c, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x48,
+  0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x22,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x0a,
+  0x2f, 0x2a, 0x20, 0x46, 0x6f, 0x72, 0x6b, 0x73, 0x20, 0x61, 0x20, 0x73,
+  0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x70,
+  0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x2e, 0x20, 0x52, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74,
+  0x69, 0x76, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x0a, 0x20, 0x2a, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65,
+  0x6e, 0x74, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x6c,
+  0x73, 0x6f, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x20, 0x66, 0x61,
+  0x69, 0x6c, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+  0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x53, 0x70, 0x65, 0x63, 0x75, 0x6c,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x20, 0x43, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20,
+  0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6e,
+  0x74, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68, 0x61, 0x73,
+  0x20, 0x62, 0x65, 0x65, 0x6e, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x75, 0x61,
+  0x74, 0x65, 0x64, 0x2e, 0x20, 0x49, 0x66, 0x20, 0x69, 0x74, 0x20, 0x66,
+  0x61, 0x69, 0x6c, 0x65, 0x64, 0x2c, 0x0a, 0x20, 0x2a, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x76,
+  0x65, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6f,
+  0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x0a, 0x20,
+  0x2a, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2e, 0x20, 0x2a, 0x2f,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x65, 0x6e, 0x64, 0x53, 0x70, 0x65,
+  0x63, 0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x62, 0x6f, 0x6f,
+  0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+  0x73, 0x75, 0x63, 0x63, 0x65, 0x65, 0x64, 0x65, 0x64, 0x29, 0x3b, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x20, 0x57, 0x61, 0x69, 0x74, 0x73, 0x20, 0x75, 0x6e,
+  0x74, 0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x61,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68,
+  0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x65, 0x64,
+  0x2e, 0x0a, 0x20, 0x2a, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6f,
+  0x63, 0x65, 0x73, 0x73, 0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x69,
+  0x66, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
+  0x6d, 0x20, 0x77, 0x61, 0x73, 0x20, 0x61, 0x62, 0x61, 0x6e, 0x64, 0x6f,
+  0x6e, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x53, 0x70, 0x65, 0x63,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x76, 0x6f, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x20, 0x2f,
+  0x2a, 0x20, 0x49, 0x4e, 0x43, 0x5f, 0x53, 0x50, 0x45, 0x43, 0x55, 0x4c,
+  0x41, 0x54, 0x49, 0x4f, 0x4e, 0x5f, 0x48, 0x20, 0x2a, 0x2f, 0x0a, 0x00
+};
+unsigned int speculation_h_len = 2219;
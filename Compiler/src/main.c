@@ -38,6 +38,7 @@
 #include "parser.h"
 #include "pretty.h"
 #include "seman.h" 
+#include <limits.h>
 
 /* The Bison parser has two separate grammars. The grammar that is parsed is 
  * determined by the first token it receives. If Bison receives GP_PROGRAM
@@ -111,12 +112,16 @@ static bool validateHostGraph(string host_file)
  * to disk in the same directory as the generated code. This is achieved by printing a
  * C array of a hex dump (generated by xxd -i). It will suffice until a proper build 
  * system is created. The C arrays are defined in libheaders.h. */
-#define LIB_HEADERS 8
-unsigned char *headers[LIB_HEADERS] = {globals_h, debug_h, graph_h, graphStacks_h,
-                                       hostParser_h, label_h, morphism_h, tracing_h};
+#define LIB_HEADERS 15
+unsigned char *headers[LIB_HEADERS] = {globals_h, adjacency_h, batch_h, candidates_h,
+                                       components_h, debug_h, graph_h, graphStacks_h,
+                                       hostParser_h, label_h, matchStore_h, morphism_h,
+                                       parallel_h, speculation_h, tracing_h};
 
-string file_names[LIB_HEADERS] = {"globals.h", "debug.h", "graph.h", "graphStacks.h", 
-                                  "hostParser.h", "label.h", "morphism.h", "tracing.h"};
+string file_names[LIB_HEADERS] = {"globals.h", "adjacency.h", "batch.h", "candidates.h",
+                                  "components.h", "debug.h", "graph.h", "graphStacks.h",
+                                  "hostParser.h", "label.h", "matchStore.h", "morphism.h",
+                                  "parallel.h", "speculation.h", "tracing.h"};
 
 void makeLibHeaders(string output_dir, unsigned char **headers, string *file_names,
                     int header_count)
@@ -166,8 +171,8 @@ void printMakeFile(string output_dir)
    fprintf(makefile, "OBJECTS := $(patsubst %%.c, %%.o, $(wildcard *.c))\n");  
    fprintf(makefile, "CC=gcc\n\n");
 
-   if(debug_flags) fprintf(makefile, "CFLAGS = -g -L$(LIB) -Wall -Wextra -lgp2debug\n\n");
-   else fprintf(makefile, "CFLAGS = -L$(LIB) -fomit-frame-pointer -O2 -Wall -Wextra -lgp2\n\n");
+   if(debug_flags) fprintf(makefile, "CFLAGS = -g -L$(LIB) -Wall -Wextra -lgp2debug -pthread\n\n");
+   else fprintf(makefile, "CFLAGS = -L$(LIB) -fomit-frame-pointer -O2 -Wall -Wextra -lgp2 -pthread\n\n");
 
    fprintf(makefile, "default:\t$(OBJECTS)\n\t\t$(CC) $(OBJECTS) $(CFLAGS) -o gp2run\n\n");
    fprintf(makefile, "%%.o:\t\t%%.c\n\t\t$(CC) -c $(CFLAGS) -o $@ $<\n\n");
@@ -181,10 +186,46 @@ bool graph_copying = false;
 /* Enables full program tracing as used by the IDE. */
 bool program_tracing = false;
 
+/* Enables incremental match maintenance for rules called inside loops. */
+bool incremental_matching = false;
+
+/* Enables locality-seeded matching for rules called inside loops. */
+bool locality_matching = false;
+
+/* Enables join matching of the edges that close cycles in the LHS. */
+bool join_matching = false;
+
+/* Enables the application of batches of independent matches in loops whose
+ * body is a single rule call. */
+bool batch_matching = false;
+
+/* Enables the matching of rule sets by a single scan of the host graph. */
+bool shared_rule_sets = false;
+
+/* The memory budget in megabytes of the runtime adjacency bitmap, or -1 for the
+ * runtime's default (see lib/adjacency.h). */
+int bitmap_budget = -1;
+
+/* The number of threads that search large host graphs for matches. 1 disables
+ * parallel matching. */
+int match_threads = 1;
+
+/* The number of worker processes that run component-local programs on the
+ * connected components of the host graph. 0 disables component execution. */
+int component_workers = 0;
+
+/* Enables the speculative execution of the else branches of try statements. */
+bool speculative_branches = false;
+
+/* The order in which the rules of rule sets are tried. */
+RuleSetPolicy rule_set_policy = SOURCE_ORDER;
+
 int main(int argc, char **argv)
 {
    string const usage = "Usage:\n"
-                        "GP2-compile [-c] [-d] [-t] [-o <outdir>] <program_file> <host_file>\n"
+                        "GP2-compile [-c] [-d] [-t] [-I] [-l] [-j] [-b] [-m] [-s <policy>] [-a <megabytes>] "
+                        "[-T <threads>] [-C <workers>] [-S] [-o <outdir>] "
+                        "<program_file> <host_file>\n"
                         "GP2-compile -p <program_file>\n"
                         "GP2-compile -r <rule_file>\n"
                         "GP2-compile -h <host_file>\n\n"
@@ -192,6 +233,22 @@ int main(int argc, char **argv)
                         "-c - Enable graph copying.\n"
                         "-d - Compile program with GCC debugging flags.\n"
                         "-t - Enable program tracing in the compiled program.\n"
+                        "-I - Enable incremental matching of rules called in loops.\n"
+                        "-l - Match rules called in loops near the last rule application first.\n"
+                        "-j - Match cyclic LHS patterns by intersecting sorted neighbour lists.\n"
+                        "-b - Apply the matches of loops over a single rule in batches of\n"
+                        "     independent matches.\n"
+                        "-m - Match the rules of rule sets in a single scan of the host graph.\n"
+                        "-s - Reorder the rules of rule sets at runtime. <policy> is 'front'\n"
+                        "     (try the last matched rule first) or 'count' (try the most\n"
+                        "     frequently matched rules first).\n"
+                        "-a - Set the memory budget of the adjacency bitmap in megabytes.\n"
+                        "     0 disables the bitmap.\n"
+                        "-T - Search large host graphs for matches on <threads> threads.\n"
+                        "-C - Run component-local programs on each connected component of\n"
+                        "     the host graph in <workers> worker processes.\n"
+                        "-S - Run the else branches of try statements in a forked process\n"
+                        "     while their conditions are evaluated.\n"
                         "-r - Validate a GP 2 rule.\n"
                         "-p - Validate a GP 2 program.\n"
                         "-h - Validate a GP 2 host graph.\n"
@@ -260,6 +317,102 @@ int main(int argc, char **argv)
                  program_tracing = true;
                  break;
 
+            case 'I':
+                 incremental_matching = true;
+                 break;
+
+            case 'l':
+                 locality_matching = true;
+                 break;
+
+            case 'j':
+                 join_matching = true;
+                 break;
+
+            case 'b':
+                 batch_matching = true;
+                 break;
+
+            case 'm':
+                 shared_rule_sets = true;
+                 break;
+
+            case 'S':
+                 speculative_branches = true;
+                 break;
+
+            case 's':
+                 argv_index++;
+                 if(argv_index == argc)
+                 {
+                    print_to_console("%s", usage);
+                    return 0; 
+                 }
+                 if(strcmp(argv[argv_index], "front") == 0) rule_set_policy = MOVE_TO_FRONT;
+                 else if(strcmp(argv[argv_index], "count") == 0) rule_set_policy = MATCH_COUNT;
+                 else
+                 {
+                    print_to_console("Error: invalid rule set policy \"%s\".\n",
+                                     argv[argv_index]);
+                    return 0;
+                 }
+                 break;
+
+            case 'a':
+            {
+                 argv_index++;
+                 if(argv_index == argc)
+                 {
+                    print_to_console("%s", usage);
+                    return 0; 
+                 }
+                 /* A budget such as "64M" or "x" is rejected rather than read
+                  * as 0, which would disable the bitmap. */
+                 char *end;
+                 long budget = strtol(argv[argv_index], &end, 10);
+                 if(end == argv[argv_index] || *end != '\0' || budget < 0 ||
+                    budget > INT_MAX)
+                 {
+                    print_to_console("Error: invalid bitmap budget \"%s\".\n",
+                                     argv[argv_index]);
+                    return 0;
+                 }
+                 bitmap_budget = budget;
+                 break;
+            }
+
+            case 'T':
+                 argv_index++;
+                 if(argv_index == argc)
+                 {
+                    print_to_console("%s", usage);
+                    return 0; 
+                 }
+                 match_threads = atoi(argv[argv_index]);
+                 if(match_threads < 1)
+                 {
+                    print_to_console("Error: invalid thread count \"%s\".\n",
+                                     argv[argv_index]);
+                    return 0;
+                 }
+                 break;
+
+            case 'C':
+                 argv_index++;
+                 if(argv_index == argc)
+                 {
+                    print_to_console("%s", usage);
+                    return 0; 
+                 }
+                 component_workers = atoi(argv[argv_index]);
+                 if(component_workers < 1)
+                 {
+                    print_to_console("Error: invalid worker count \"%s\".\n",
+                                     argv[argv_index]);
+                    return 0;
+                 }
+                 break;
+
             case 'o':
                  argv_index++;
                  if(argv_index == argc)
@@ -285,6 +438,44 @@ int main(int argc, char **argv)
       host_file = argv[argv_index];
    }
 
+   /* Match stores are attached to the host graph that exists when they are
+    * created, so they cannot follow graph copies. */
+   if(incremental_matching && graph_copying)
+   {
+      print_to_console("Warning: incremental matching is not supported with graph "
+                       "copying and has been disabled.\n");
+      incremental_matching = false;
+   }
+
+   /* Rule set reordering takes place before the rule calls are traced, which
+    * would leave the trace without the failed match attempts. */
+   if(rule_set_policy != SOURCE_ORDER && program_tracing)
+   {
+      print_to_console("Warning: rule set reordering is not supported with program "
+                       "tracing and has been disabled.\n");
+      rule_set_policy = SOURCE_ORDER;
+   }
+
+   /* Component execution runs the program on graphs other than the host graph,
+    * as batch mode does, so it excludes the same features (see
+    * generateRuntimeMain). */
+   if(component_workers > 0 && (incremental_matching || locality_matching || program_tracing))
+   {
+      print_to_console("Warning: component execution is not supported with incremental "
+                       "matching, locality-seeded matching or program tracing and has "
+                       "been disabled.\n");
+      component_workers = 0;
+   }
+
+   /* The trace is written by the process that evaluates a condition, which the
+    * speculative process would not continue. */
+   if(speculative_branches && program_tracing)
+   {
+      print_to_console("Warning: speculative try statements are not supported with "
+                       "program tracing and have been disabled.\n");
+      speculative_branches = false;
+   }
+
    /* If no output directory specified, make a directory in /tmp. */
    if(output_dir == NULL) 
    {
@@ -345,6 +536,13 @@ int main(int argc, char **argv)
       else
       {
          print_to_console("Generating program code...\n\n");
+         annotateRuleCalls(gp_program);
+         if(component_workers > 0 && !isComponentLocal(gp_program))
+         {
+            print_to_console("Warning: the program is not component-local, so component "
+                             "execution has been disabled.\n\n");
+            component_workers = 0;
+         }
          generateRules(gp_program, output_dir);
          staticAnalysis(gp_program);   
          #ifdef DEBUG_PROGRAM
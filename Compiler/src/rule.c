@@ -310,6 +310,18 @@ bool isPredicate(Rule *rule)
    return true;
 }
 
+bool isSharableNode(RuleNode *node)
+{
+   RuleNode *right_node = node->interface;
+   if(right_node == NULL) return false;
+   if(right_node->relabelled || right_node->remarked || right_node->root_changed)
+      return false;
+   /* The predicates of a node are degree predicates and edge predicates, whose
+    * values other matches can change by adding or deleting edges at the node. */
+   if(node->predicate_count > 0) return false;
+   return !node->indegree_arg && !node->outdegree_arg;
+}
+
 Variable *getVariable(Rule *rule, string name)
 {
    int index;
@@ -379,12 +391,16 @@ RuleList *appendRuleAtom(RuleList *list, RuleAtom *atom)
 static bool equalAtoms(RuleAtom *left_atom, RuleAtom *right_atom)
 {
    if(left_atom->type != right_atom->type) return false;
-   /* LHS labels are simple expressions; there are only a few cases to consider. */
    switch(left_atom->type)
    {
       case VARIABLE:
+      case LENGTH:
            return left_atom->variable.id == right_atom->variable.id;
 
+      case INDEGREE:
+      case OUTDEGREE:
+           return left_atom->node_id == right_atom->node_id;
+
       case INTEGER_CONSTANT:
            return left_atom->number == right_atom->number;
 
@@ -394,6 +410,10 @@ static bool equalAtoms(RuleAtom *left_atom, RuleAtom *right_atom)
       case NEG:
            return equalAtoms(left_atom->neg_exp, right_atom->neg_exp);
 
+      case ADD:
+      case SUBTRACT:
+      case MULTIPLY:
+      case DIVIDE:
       case CONCAT:
            if(!equalAtoms(left_atom->bin_op.left_exp, 
                           right_atom->bin_op.left_exp)) return false;
@@ -237,6 +237,13 @@ void addVariablePredicate(Variable *variable, Predicate *predicate, int size);
 /* Checks if a rule does not modify the host graph: the rule neither adds nor
  * deletes nor relabels any items. */
 bool isPredicate(Rule *rule);
+/* Checks if the LHS node is preserved by the rule without changing its label,
+ * mark or root status, and is not an argument of a predicate or of a degree
+ * operator in the RHS. Matches of the rule that overlap only in host nodes
+ * matched by such nodes are independent: applying one does not change the
+ * other or the result of applying it. Used by batched loops (see parallel.h
+ * in the runtime library). */
+bool isSharableNode(RuleNode *node);
 
 Variable *getVariable(Rule *rule, string name);
 int getVariableId(Rule *rule, string name);
@@ -247,7 +254,8 @@ RuleEdge *getRuleEdge(RuleGraph *graph, int index);
  * transformation. */
 RuleList *appendRuleAtom(RuleList *list, RuleAtom *atom);
 /* Used to compare LHS labels with RHS labels to check if a node or edge is
- * relabelled by the rule. */
+ * relabelled by the rule, and by the symmetry module to compare the labels of
+ * two items of the same rule graph. */
 bool equalRuleLists(RuleLabel left_label, RuleLabel right_label);
 /* Used to determine the appropriate function call to generate label matching code. */
 bool hasListVariable(RuleLabel label);
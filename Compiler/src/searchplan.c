@@ -15,10 +15,13 @@
 
 #include "searchplan.h"
 
-static void traverseNode(Searchplan *searchplan, RuleNode *node, char type, 
-                         bool *tagged_nodes, bool *tagged_edges);
-static void traverseEdge(Searchplan *searchplan, RuleEdge *node, char type, 
-                         bool *tagged_nodes, bool *tagged_edges);
+static void traverseNode(Searchplan *searchplan, RuleGraph *lhs, RuleNode *node,
+                         char type, bool *tagged_nodes, bool *tagged_edges);
+static void traverseIncidentEdges(Searchplan *searchplan, RuleGraph *lhs,
+                                  RuleNode *node, bool *tagged_nodes,
+                                  bool *tagged_edges);
+static void traverseEdge(Searchplan *searchplan, RuleGraph *lhs, RuleEdge *node,
+                         char type, bool *tagged_nodes, bool *tagged_edges);
 
 static Searchplan *makeSearchplan(void)
 {
@@ -61,7 +64,48 @@ static void appendSearchOp(Searchplan *plan, char type, int index)
    }
 }  
 
-Searchplan *generateSearchplan(RuleGraph *lhs)
+/* Returns 2 if the node shares a predicate with a tagged node, 1 if the node
+ * occurs in some predicate, and 0 otherwise. Nodes with a higher priority are
+ * visited first so that predicates are decided as early as possible. */
+static int predicatePriority(RuleGraph *lhs, RuleNode *node, bool *tagged_nodes)
+{
+   if(node->predicate_count == 0) return 0;
+   int index, p, q;
+   for(index = 0; index < lhs->node_index; index++)
+   {
+      if(!tagged_nodes[index]) continue;
+      RuleNode *tagged_node = getRuleNode(lhs, index);
+      for(p = 0; p < node->predicate_count; p++)
+         for(q = 0; q < tagged_node->predicate_count; q++)
+            if(node->predicates[p] == tagged_node->predicates[q]) return 2;
+   }
+   return 1;
+}
+
+/* Returns the first LHS edge whose mark is more selective than the mark of
+ * every LHS node, or NULL. Only edges with a colour or dashed mark qualify, and
+ * only if no LHS node has one, since host items with a mark other than none are
+ * usually rare. Loops and bidirectional edges are not considered: the
+ * endpoints of the other edges are matched directly from the host edge. */
+static RuleEdge *getSelectiveEdge(RuleGraph *lhs)
+{
+   int index;
+   for(index = 0; index < lhs->node_index; index++)
+   {
+      RuleNode *node = getRuleNode(lhs, index);
+      if(node->root) return NULL;
+      if(node->label.mark != NONE && node->label.mark != ANY) return NULL;
+   }
+   for(index = 0; index < lhs->edge_index; index++)
+   {
+      RuleEdge *edge = getRuleEdge(lhs, index);
+      if(edge->source == edge->target || edge->bidirectional) continue;
+      if(edge->label.mark != NONE && edge->label.mark != ANY) return edge;
+   }
+   return NULL;
+}
+
+Searchplan *generateSearchplan(RuleGraph *lhs, bool edge_first)
 {
    Searchplan *searchplan = makeSearchplan();
    bool tagged_nodes[lhs->node_index]; 
@@ -70,63 +114,109 @@ Searchplan *generateSearchplan(RuleGraph *lhs)
    for(index = 0; index < lhs->node_index; index++) tagged_nodes[index] = false;
    for(index = 0; index < lhs->edge_index; index++) tagged_edges[index] = false;
 
+   /* Start from a selective edge and match both of its endpoints from it. */
+   RuleEdge *start_edge = edge_first ? getSelectiveEdge(lhs) : NULL;
+   if(start_edge != NULL)
+   {
+      tagged_edges[start_edge->index] = true;
+      appendSearchOp(searchplan, 'e', start_edge->index);
+      tagged_nodes[start_edge->source->index] = true;
+      appendSearchOp(searchplan, 'o', start_edge->source->index);
+      tagged_nodes[start_edge->target->index] = true;
+      appendSearchOp(searchplan, 'i', start_edge->target->index);
+      traverseIncidentEdges(searchplan, lhs, start_edge->source, tagged_nodes,
+                            tagged_edges);
+      traverseIncidentEdges(searchplan, lhs, start_edge->target, tagged_nodes,
+                            tagged_edges);
+   }
+
    /* Perform a depth-first traversal of the graph from its root nodes. */
    for(index = 0; index < lhs->node_index; index++)
    {
       RuleNode *node = getRuleNode(lhs, index);
       if(node->root && !tagged_nodes[node->index]) 
-         traverseNode(searchplan, node, 'r', tagged_nodes, tagged_edges);
+         traverseNode(searchplan, lhs, node, 'r', tagged_nodes, tagged_edges);
    }
 
    /* Search for undiscovered nodes, namely nodes that are not reachable 
-    * from a root node. */
-   for(index = 0; index < lhs->node_index; index++)
+    * from a root node. Nodes sharing a predicate with an already tagged node
+    * are preferred, then nodes occurring in any predicate. */
+   while(true)
    {
-      if(!tagged_nodes[index]) 
+      RuleNode *next_node = NULL;
+      int priority = -1;
+      for(index = 0; index < lhs->node_index; index++)
       {
+         if(tagged_nodes[index]) continue;
          RuleNode *node = getRuleNode(lhs, index);
-         traverseNode(searchplan, node, 'n', tagged_nodes, tagged_edges);
+         int node_priority = predicatePriority(lhs, node, tagged_nodes);
+         if(node_priority > priority)
+         {
+            next_node = node;
+            priority = node_priority;
+         }
       }
+      if(next_node == NULL) break;
+      traverseNode(searchplan, lhs, next_node, 'n', tagged_nodes, tagged_edges);
    }
    return searchplan;
 }
 
-static void traverseNode(Searchplan *searchplan, RuleNode *node, char type, 
-                  bool *tagged_nodes, bool *tagged_edges)
+static void traverseNode(Searchplan *searchplan, RuleGraph *lhs, RuleNode *node,
+                         char type, bool *tagged_nodes, bool *tagged_edges)
 {
    tagged_nodes[node->index] = true;
    appendSearchOp(searchplan, type, node->index);
+   traverseIncidentEdges(searchplan, lhs, node, tagged_nodes, tagged_edges);
+}
+
+static void traverseIncidentEdges(Searchplan *searchplan, RuleGraph *lhs,
+                                  RuleNode *node, bool *tagged_nodes,
+                                  bool *tagged_edges)
+{
    /* Search the node's incident edges for an untagged edge. Outedges
-    * are arbitrarily examined first. If no such edges exist, the function
-    * exits and control passes to the caller. */
-   RuleEdges *iterator = node->outedges;
-   while(iterator != NULL)
+    * are arbitrarily examined first, except that edges leading to untagged
+    * nodes of a higher predicate priority are examined before the others.
+    * If no such edges exist, the function exits and control passes to the
+    * caller. */
+   int priority;
+   for(priority = 2; priority >= 0; priority--)
    {
-      RuleEdge *edge = iterator->edge;
-      if(!tagged_edges[edge->index])
+      RuleEdges *iterator = node->outedges;
+      while(iterator != NULL)
       {
-         if(edge->source == edge->target) 
-              traverseEdge(searchplan, edge, 'l', tagged_nodes, tagged_edges);
-         else traverseEdge(searchplan, edge, 's', tagged_nodes, tagged_edges);
+         RuleEdge *edge = iterator->edge;
+         RuleNode *target = edge->target;
+         int edge_priority = tagged_nodes[target->index] ? 0 :
+                             predicatePriority(lhs, target, tagged_nodes);
+         if(!tagged_edges[edge->index] && edge_priority >= priority)
+         {
+            if(edge->source == edge->target) 
+                 traverseEdge(searchplan, lhs, edge, 'l', tagged_nodes, tagged_edges);
+            else traverseEdge(searchplan, lhs, edge, 's', tagged_nodes, tagged_edges);
+         }
+         iterator = iterator->next;
       }
-      iterator = iterator->next;
-   }
-   iterator = node->inedges;
-   while(iterator != NULL)
-   {
-      RuleEdge *edge = iterator->edge;
-      if(!tagged_edges[edge->index])
+      iterator = node->inedges;
+      while(iterator != NULL)
       {
-         if(edge->source == edge->target)
-              traverseEdge(searchplan, edge, 'l', tagged_nodes, tagged_edges);
-         else traverseEdge(searchplan, edge, 't', tagged_nodes, tagged_edges);
+         RuleEdge *edge = iterator->edge;
+         RuleNode *source = edge->source;
+         int edge_priority = tagged_nodes[source->index] ? 0 :
+                             predicatePriority(lhs, source, tagged_nodes);
+         if(!tagged_edges[edge->index] && edge_priority >= priority)
+         {
+            if(edge->source == edge->target)
+                 traverseEdge(searchplan, lhs, edge, 'l', tagged_nodes, tagged_edges);
+            else traverseEdge(searchplan, lhs, edge, 't', tagged_nodes, tagged_edges);
+         }
+         iterator = iterator->next;
       }
-      iterator = iterator->next;
    }
 }
 
-static void traverseEdge(Searchplan *searchplan, RuleEdge *edge, char type,
-                  bool *tagged_nodes, bool *tagged_edges)
+static void traverseEdge(Searchplan *searchplan, RuleGraph *lhs, RuleEdge *edge,
+                         char type, bool *tagged_nodes, bool *tagged_edges)
 {
    tagged_edges[edge->index] = true;
    appendSearchOp(searchplan, type, edge->index);
@@ -142,8 +232,8 @@ static void traverseEdge(Searchplan *searchplan, RuleEdge *edge, char type,
       if(!tagged_nodes[target->index])
       {
          if(edge->bidirectional) 
-              traverseNode(searchplan, target, 'b', tagged_nodes, tagged_edges);
-         else traverseNode(searchplan, target, 'i', tagged_nodes, tagged_edges);
+              traverseNode(searchplan, lhs, target, 'b', tagged_nodes, tagged_edges);
+         else traverseNode(searchplan, lhs, target, 'i', tagged_nodes, tagged_edges);
       }
    }      
    else /* type == 't' */ 
@@ -152,8 +242,8 @@ static void traverseEdge(Searchplan *searchplan, RuleEdge *edge, char type,
       if(!tagged_nodes[source->index])
       {
          if(edge->bidirectional) 
-              traverseNode(searchplan, source, 'b', tagged_nodes, tagged_edges);
-         else traverseNode(searchplan, source, 'o', tagged_nodes, tagged_edges);  
+              traverseNode(searchplan, lhs, source, 'b', tagged_nodes, tagged_edges);
+         else traverseNode(searchplan, lhs, source, 'o', tagged_nodes, tagged_edges);  
       }
    }
 }
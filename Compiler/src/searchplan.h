@@ -70,11 +70,24 @@ typedef struct Searchplan {
  * (2) Scan the node list of the graph, performing step 2 on any untagged nodes.
  *     Unnecessary if the input graph is root-connected.
  *
+ * If edge_first is set and the graph has no root nodes, the search may instead
+ * start from an edge whose mark is more selective than the marks of all nodes
+ * (a marked edge between unmarked nodes). The 'e' operation of the edge is
+ * followed by an 'o' operation for its source and an 'i' operation for its
+ * target, both matched from the host edge, and the traversal continues from
+ * the two endpoints before step (2).
+ *
+ * If the rule has a condition, nodes are visited in an order that decides the
+ * predicates early: in both steps, untagged nodes sharing a predicate with a
+ * tagged node are visited first, followed by other nodes occurring in a 
+ * predicate. In step 1, this only changes the order in which the incident
+ * edges of a node are examined.
+ *
  * The depth-first search is performed by recursive calls to traverseNode and
  * traverseEdge. These two functions are responsible for checking if items
  * are tagged, tagging items, and adding new operations to the searchplan. */ 
 
-Searchplan *generateSearchplan(RuleGraph *lhs);
+Searchplan *generateSearchplan(RuleGraph *lhs, bool edge_first);
 
 void printSearchplan(Searchplan *searchplan);
 void freeSearchplan(Searchplan *searchplan);
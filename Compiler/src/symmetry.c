@@ -0,0 +1,359 @@
+/* Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>. */
+
+#include "symmetry.h"
+
+/* State of the enumeration of the automorphisms of a rule's LHS.
+ * fixed - Indexed by LHS node. Set for the nodes that must be fixed.
+ * directed - nodes * nodes matrix. Entry (i, j) is the number of directed LHS
+ *            edges from node i to node j.
+ * bidirectional - As above for bidirectional edges, which are counted at
+ *                 both (i, j) and (j, i).
+ * permutation - The images of the nodes assigned so far.
+ * elements - The automorphisms found so far, each stored as <nodes> images.
+ * steps - The number of partial permutations extended so far.
+ * overflow - Set if there are too many automorphisms or search steps. */
+typedef struct Automorphisms {
+   Rule *rule;
+   int nodes;
+   bool *fixed;
+   int *directed, *bidirectional;
+   int *permutation;
+   bool *used;
+   int count;
+   int *elements;
+   int steps;
+   bool overflow;
+} Automorphisms;
+
+static void *allocate(int count, size_t size)
+{
+   void *pointer = calloc(count > 0 ? count : 1, size);
+   if(pointer == NULL)
+   {
+      print_to_log("Error (breakSymmetries): malloc failure.\n");
+      exit(1);
+   }
+   return pointer;
+}
+
+static bool equalLabels(RuleLabel left_label, RuleLabel right_label)
+{
+   if(left_label.mark != right_label.mark) return false;
+   return equalRuleLists(left_label, right_label);
+}
+
+/* Fixes the LHS nodes corresponding to the RHS nodes whose degrees are used
+ * in the atom. */
+static void fixDegreeArguments(Rule *rule, RuleAtom *atom, bool *fixed)
+{
+   RuleNode *node = NULL;
+   switch(atom->type)
+   {
+      case INDEGREE:
+      case OUTDEGREE:
+           node = getRuleNode(rule->rhs, atom->node_id);
+           if(node->interface != NULL) fixed[node->interface->index] = true;
+           break;
+
+      case NEG:
+           fixDegreeArguments(rule, atom->neg_exp, fixed);
+           break;
+
+      case ADD:
+      case SUBTRACT:
+      case MULTIPLY:
+      case DIVIDE:
+      case CONCAT:
+           fixDegreeArguments(rule, atom->bin_op.left_exp, fixed);
+           fixDegreeArguments(rule, atom->bin_op.right_exp, fixed);
+           break;
+
+      default: break;
+   }
+}
+
+static void fixLabelDegreeArguments(Rule *rule, RuleLabel label, bool *fixed)
+{
+   if(label.list == NULL) return;
+   RuleListItem *item = label.list->first;
+   while(item != NULL)
+   {
+      fixDegreeArguments(rule, item->atom, fixed);
+      item = item->next;
+   }
+}
+
+/* Tests if node j can be the image of node i, given the images of the nodes
+ * with smaller indices. The RHS nodes of preserved nodes are compared here as
+ * well, so that a symmetric LHS with an asymmetric RHS is rejected early. */
+static bool compatibleNodes(Automorphisms *data, int i, int j)
+{
+   int nodes = data->nodes;
+   if((data->fixed[i] || data->fixed[j]) && i != j) return false;
+   RuleNode *left = getRuleNode(data->rule->lhs, i);
+   RuleNode *right = getRuleNode(data->rule->lhs, j);
+   if(left->root != right->root) return false;
+   if(left->indegree != right->indegree || left->outdegree != right->outdegree ||
+      left->bidegree != right->bidegree) return false;
+   if((left->interface == NULL) != (right->interface == NULL)) return false;
+   if(!equalLabels(left->label, right->label)) return false;
+   if(left->interface != NULL)
+   {
+      if(left->interface->root != right->interface->root) return false;
+      if(!equalLabels(left->interface->label, right->interface->label)) return false;
+   }
+   if(data->directed[i * nodes + i] != data->directed[j * nodes + j]) return false;
+   if(data->bidirectional[i * nodes + i] != data->bidirectional[j * nodes + j])
+      return false;
+   int k;
+   for(k = 0; k < i; k++)
+   {
+      int image = data->permutation[k];
+      if(data->directed[i * nodes + k] != data->directed[j * nodes + image]) return false;
+      if(data->directed[k * nodes + i] != data->directed[image * nodes + j]) return false;
+      if(data->bidirectional[i * nodes + k] != data->bidirectional[j * nodes + image])
+         return false;
+   }
+   return true;
+}
+
+/* Tests if the rule edge <image> can be the image of <edge> given the images
+ * of its incident nodes. */
+static bool edgeImage(RuleEdge *edge, RuleEdge *image, int source, int target)
+{
+   if(edge->bidirectional != image->bidirectional) return false;
+   if(!equalLabels(edge->label, image->label)) return false;
+   if(image->source->index == source && image->target->index == target) return true;
+   return edge->bidirectional && image->source->index == target &&
+          image->target->index == source;
+}
+
+/* Tests if the completed permutation satisfies conditions (1) and (3) of
+ * breakSymmetries. The arrays are indexed by LHS edge, RHS node and RHS edge
+ * respectively. Parallel edges are paired greedily, which may reject an
+ * automorphism but never accepts an unsuitable one. */
+static bool extendsToRule(Automorphisms *data, int *edge_map, int *rhs_map,
+                          bool *rhs_used)
+{
+   RuleGraph *lhs = data->rule->lhs, *rhs = data->rule->rhs;
+   int *permutation = data->permutation;
+   int index, candidate;
+   for(index = 0; index < lhs->edge_index; index++)
+   {
+      RuleEdge *edge = getRuleEdge(lhs, index);
+      for(candidate = 0; candidate < lhs->edge_index; candidate++)
+      {
+         RuleEdge *image = getRuleEdge(lhs, candidate);
+         int previous;
+         for(previous = 0; previous < index; previous++)
+            if(edge_map[previous] == candidate) break;
+         if(previous < index) continue;
+         if((edge->interface == NULL) != (image->interface == NULL)) continue;
+         if(edgeImage(edge, image, permutation[edge->source->index],
+                      permutation[edge->target->index])) break;
+      }
+      if(candidate == lhs->edge_index) return false;
+      edge_map[index] = candidate;
+   }
+   /* A rule with an empty RHS deletes every matched item. */
+   if(rhs == NULL) return true;
+   /* Interface nodes are mapped as their LHS nodes; added nodes are fixed. */
+   for(index = 0; index < rhs->node_index; index++)
+   {
+      RuleNode *node = getRuleNode(rhs, index);
+      if(node->interface == NULL) rhs_map[index] = index;
+      else rhs_map[index] =
+              getRuleNode(lhs, permutation[node->interface->index])->interface->index;
+   }
+   for(index = 0; index < rhs->node_index; index++)
+   {
+      RuleNode *node = getRuleNode(rhs, index);
+      RuleNode *image = getRuleNode(rhs, rhs_map[index]);
+      if(node->root != image->root) return false;
+      if(!equalLabels(node->label, image->label)) return false;
+   }
+   for(index = 0; index < rhs->edge_index; index++) rhs_used[index] = false;
+   for(index = 0; index < rhs->edge_index; index++)
+   {
+      RuleEdge *edge = getRuleEdge(rhs, index);
+      int source = rhs_map[edge->source->index], target = rhs_map[edge->target->index];
+      if(edge->interface != NULL)
+      {
+         RuleEdge *image = getRuleEdge(lhs, edge_map[edge->interface->index])->interface;
+         if(!edgeImage(edge, image, source, target)) return false;
+         continue;
+      }
+      for(candidate = 0; candidate < rhs->edge_index; candidate++)
+      {
+         RuleEdge *image = getRuleEdge(rhs, candidate);
+         if(rhs_used[candidate] || image->interface != NULL) continue;
+         if(edgeImage(edge, image, source, target)) break;
+      }
+      if(candidate == rhs->edge_index) return false;
+      rhs_used[candidate] = true;
+   }
+   return true;
+}
+
+static void findAutomorphisms(Automorphisms *data, int i)
+{
+   if(data->overflow) return;
+   if(i == data->nodes)
+   {
+      RuleGraph *lhs = data->rule->lhs, *rhs = data->rule->rhs;
+      int *edge_map = allocate(lhs->edge_index, sizeof(int));
+      int *rhs_map = allocate(rhs == NULL ? 0 : rhs->node_index, sizeof(int));
+      bool *rhs_used = allocate(rhs == NULL ? 0 : rhs->edge_index, sizeof(bool));
+      bool automorphism = extendsToRule(data, edge_map, rhs_map, rhs_used);
+      free(edge_map);
+      free(rhs_map);
+      free(rhs_used);
+      if(!automorphism) return;
+      if(data->count == MAX_AUTOMORPHISMS)
+      {
+         data->overflow = true;
+         return;
+      }
+      memcpy(data->elements + data->count * data->nodes, data->permutation,
+             data->nodes * sizeof(int));
+      data->count++;
+      return;
+   }
+   int j;
+   for(j = 0; j < data->nodes; j++)
+   {
+      if(data->used[j] || !compatibleNodes(data, i, j)) continue;
+      if(++data->steps > MAX_AUTOMORPHISM_STEPS)
+      {
+         data->overflow = true;
+         return;
+      }
+      data->permutation[i] = j;
+      data->used[j] = true;
+      findAutomorphisms(data, i + 1);
+      data->used[j] = false;
+   }
+}
+
+static SymmetryConstraint *addConstraint(SymmetryConstraint *constraints,
+                                         int smaller, int larger)
+{
+   SymmetryConstraint *constraint = malloc(sizeof(SymmetryConstraint));
+   if(constraint == NULL)
+   {
+      print_to_log("Error (addConstraint): malloc failure.\n");
+      exit(1);
+   }
+   constraint->smaller = smaller;
+   constraint->larger = larger;
+   constraint->next = constraints;
+   return constraint;
+}
+
+SymmetryConstraint *breakSymmetries(Rule *rule, Searchplan *searchplan)
+{
+   int nodes = rule->lhs->node_index;
+   if(nodes < 2) return NULL;
+   Automorphisms data;
+   data.rule = rule;
+   data.nodes = nodes;
+   data.fixed = allocate(nodes, sizeof(bool));
+   data.directed = allocate(nodes * nodes, sizeof(int));
+   data.bidirectional = allocate(nodes * nodes, sizeof(int));
+   data.permutation = allocate(nodes, sizeof(int));
+   data.used = allocate(nodes, sizeof(bool));
+   data.count = 0;
+   data.elements = allocate(MAX_AUTOMORPHISMS * nodes, sizeof(int));
+   data.steps = 0;
+   data.overflow = false;
+
+   int index;
+   for(index = 0; index < nodes; index++)
+      if(getRuleNode(rule->lhs, index)->predicate_count > 0) data.fixed[index] = true;
+   if(rule->rhs != NULL)
+   {
+      for(index = 0; index < rule->rhs->node_index; index++)
+         fixLabelDegreeArguments(rule, getRuleNode(rule->rhs, index)->label, data.fixed);
+      for(index = 0; index < rule->rhs->edge_index; index++)
+         fixLabelDegreeArguments(rule, getRuleEdge(rule->rhs, index)->label, data.fixed);
+   }
+   for(index = 0; index < rule->lhs->edge_index; index++)
+   {
+      RuleEdge *edge = getRuleEdge(rule->lhs, index);
+      int source = edge->source->index, target = edge->target->index;
+      if(!edge->bidirectional) data.directed[source * nodes + target]++;
+      else
+      {
+         data.bidirectional[source * nodes + target]++;
+         if(source != target) data.bidirectional[target * nodes + source]++;
+      }
+   }
+   findAutomorphisms(&data, 0);
+
+   SymmetryConstraint *constraints = NULL;
+   /* active[g] is set while automorphism g is in the current group. */
+   bool *active = allocate(data.count, sizeof(bool));
+   bool *orbit = allocate(nodes, sizeof(bool));
+   int element;
+   for(element = 0; element < data.count; element++) active[element] = true;
+   while(!data.overflow)
+   {
+      /* Find the first node in the searchplan that is moved by the group. */
+      int node = -1;
+      SearchOp *operation = searchplan->first;
+      while(operation != NULL && node < 0)
+      {
+         if(operation->is_node)
+         {
+            for(element = 0; element < data.count; element++)
+               if(active[element] &&
+                  data.elements[element * nodes + operation->index] != operation->index)
+                  node = operation->index;
+         }
+         operation = operation->next;
+      }
+      if(node < 0) break;
+      for(index = 0; index < nodes; index++) orbit[index] = false;
+      for(element = 0; element < data.count; element++)
+      {
+         if(!active[element]) continue;
+         int image = data.elements[element * nodes + node];
+         if(image == node) continue;
+         if(!orbit[image]) constraints = addConstraint(constraints, node, image);
+         orbit[image] = true;
+         active[element] = false;
+      }
+   }
+   free(active);
+   free(orbit);
+   free(data.fixed);
+   free(data.directed);
+   free(data.bidirectional);
+   free(data.permutation);
+   free(data.used);
+   free(data.elements);
+   return constraints;
+}
+
+void freeSymmetryConstraints(SymmetryConstraint *constraints)
+{
+   while(constraints != NULL)
+   {
+      SymmetryConstraint *next = constraints->next;
+      free(constraints);
+      constraints = next;
+   }
+}
@@ -0,0 +1,72 @@
+/* ///////////////////////////////////////////////////////////////////////////
+
+  Copyright 2015-2016 Christopher Bak
+
+  This file is part of the GP 2 Compiler. The GP 2 Compiler is free software:
+  you can redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either version 3
+  of the License, or (at your option) any later version.
+
+  The GP 2 Compiler is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+  more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the GP 2 Compiler. If not, see <http://www.gnu.org/licenses/>.
+
+  ===============
+  Symmetry Module
+  ===============
+
+  If the LHS of a rule has a non-trivial automorphism that leaves the effect of
+  the rule unchanged, every match of the rule has an equivalent match obtained
+  by composing it with the automorphism. Only one match of each such class
+  needs to be found. This module computes the group of these automorphisms and
+  derives ordering constraints on the host indices of the LHS nodes that hold
+  for exactly one match of each class. The constraints are checked by the
+  generated matching functions.
+
+/////////////////////////////////////////////////////////////////////////// */
+
+#ifndef INC_SYMMETRY_H
+#define INC_SYMMETRY_H
+
+#include "globals.h"
+#include "rule.h"
+#include "searchplan.h"
+
+/* The automorphisms are enumerated explicitly. If there are more than
+ * MAX_AUTOMORPHISMS, or the search extends more than MAX_AUTOMORPHISM_STEPS
+ * partial permutations, no constraints are generated for the rule. */
+#define MAX_AUTOMORPHISMS 5040
+#define MAX_AUTOMORPHISM_STEPS 100000
+
+/* The host index of the LHS node <smaller> must be less than the host index of
+ * the LHS node <larger>. <smaller> precedes <larger> in the searchplan, so the
+ * constraint is checked by the matching function of <larger>. */
+typedef struct SymmetryConstraint {
+   int smaller, larger;
+   struct SymmetryConstraint *next;
+} SymmetryConstraint;
+
+/* An automorphism of the LHS is used for symmetry breaking if:
+ * (1) It preserves the labels, root flags and edges of the LHS, and maps
+ *     preserved items to preserved items.
+ * (2) It fixes each node that occurs in the rule's condition or as the argument
+ *     of a degree operator in the RHS.
+ * (3) Mapping the interface nodes accordingly and fixing the added nodes gives
+ *     an automorphism of the RHS.
+ * Then a match and its composition with the automorphism have the same effect
+ * on the host graph, up to the order in which items are added.
+ *
+ * The constraints are generated from the group G of these automorphisms:
+ * (a) Let u be the first node in the searchplan that is moved by some
+ *     automorphism in G. If there is none, stop.
+ * (b) For each other node w in the orbit of u, add the constraint (u, w).
+ * (c) Replace G with the automorphisms in G that fix u and go to (a).
+ * Returns NULL if the group is trivial or too large. */
+SymmetryConstraint *breakSymmetries(Rule *rule, Searchplan *searchplan);
+void freeSymmetryConstraints(SymmetryConstraint *constraints);
+
+#endif /* INC_SYMMETRY_H */